@@ -22,8 +22,10 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <fcntl.h>
 #include <unistd.h>
 #include <sys/file.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 
 #include "ed.h"
@@ -32,35 +34,116 @@
 static int current_addr_ = 0;	/* current address in editor buffer */
 static int last_addr_ = 0;	/* last address in editor buffer */
 static bool isbinary_ = false;	/* if set, buffer contains ASCII NULs */
+static bool nonascii_ = false;	/* if set, buffer contains bytes > 0x7F */
 static bool modified_ = false;	/* if set, buffer modified since last write */
 
 static bool seek_write = false;	/* seek before writing */
 static FILE * sfp = 0;		/* scratch file pointer */
 static long sfpos = 0;		/* scratch file position */
+static bool use_mmap = false;	/* if set, scratch file is memory-mapped */
+static char * smap = 0;		/* mapping of the scratch file */
+static long smap_size = 0;	/* size of the mapping ( and of the file ) */
+static long smap_end = 0;	/* size of the text stored in the mapping */
+static long smap_moves = 0;	/* times the mapping moved when growing */
+static long sfend = 0;		/* size of the scratch file, if not mapped */
+static const long pos_limit = 1L << 47;	/* line_t::pos has 48 bits */
+enum { compact_min = 1 << 24 };	/* min dead text worth compacting */
+static long compact_check = compact_min;	/* size for next compaction check */
+static int compactions = 0;
+static long reclaimed = 0;	/* bytes reclaimed by compaction */
+static long sb_reads = 0, sb_read_bytes = 0;	/* lines copied from scratch */
+static long sb_texts = 0;	/* lines read in place by get_sbuf_text */
+static long sb_writes = 0, sb_write_bytes = 0;	/* blocks written */
+static long sb_seeks = 0;	/* seeks of the stdio scratch file */
+static long ln_searches = 0;	/* calls to search_line_node */
+static long ln_steps = 0;	/* nodes walked by search_line_node */
+static long ln_lookups = 0;	/* index lookups by search_line_node */
+static long slabs_allocated = 0;
+static long undo_atoms = 0;	/* undo atoms pushed */
+static line_t * free_nodes = 0;	/* free list of line nodes */
 static line_t buffer_head;	/* editor buffer ( linked list of line_t )*/
 static line_t yank_buffer_head;
+static line_t * yank_head = 0;	/* if set, the cut buffer is the deleted */
+static line_t * yank_tail = 0;	/* lines yank_head..yank_tail of a UDEL */
+static line_t * cached_lp = &buffer_head;	/* last line searched */
+static int cached_addr = 0;		/* address of cached_lp */
+
+typedef struct			/* input file mapped by map_source */
+  {
+  const char * map;		/* mapping of the file ( or of its copy ) */
+  long size;			/* size of the file */
+  long same;			/* bytes at its start still in the file */
+  int fd;			/* leased descriptor, or -1 if copied */
+  dev_t dev;
+  ino_t ino;
+  }
+source_t;
+
+enum { sources_max = 32 };
+static source_t sources[sources_max];	/* lines with lf_source point here */
+static int nsources = 0;
+
+/* A file read lazily is indexed as its lines are addressed. The lines
+   not yet indexed always follow the last line of the buffer. */
+enum { lazy_last = INT_MAX };	/* current address is the last line */
+static int lazy_src = -1;	/* source being indexed, if >= 0 */
+static long lazy_pos = 0;	/* position of its first line not indexed */
+static int lazy_lines = 0;	/* lines indexed lazily so far */
+
+static void index_lazy_lines( const int addr );
 
 
-int current_addr( void ) { return current_addr_; }
+int current_addr( void )
+  {
+  if( current_addr_ == lazy_last )
+    { if( lazy_src >= 0 ) index_lazy_lines( INT_MAX );
+      current_addr_ = last_addr_; }
+  return current_addr_;
+  }
 int inc_current_addr( void )
-  { if( ++current_addr_ > last_addr_ ) current_addr_ = last_addr_;
+  { if( current_addr() < last_addr_upto( current_addr_ ) ) ++current_addr_;
     return current_addr_; }
 void set_current_addr( const int addr ) { current_addr_ = addr; }
 
-int last_addr( void ) { return last_addr_; }
+int last_addr( void )
+  { if( lazy_src >= 0 ) index_lazy_lines( INT_MAX ); return last_addr_; }
+
+/* Return the last address, indexing the lines of a file read lazily
+   only until 'addr' and the line following it exist. */
+int last_addr_upto( const int addr )
+  { if( lazy_src >= 0 && addr >= last_addr_ ) index_lazy_lines( addr + 1 );
+    return last_addr_; }
 
 bool isbinary( void ) { return isbinary_; }
 void set_binary( void ) { isbinary_ = true; }
+bool nonascii( void ) { return nonascii_; }
+
+/* set nonascii_ if the text of 'size' bytes at s is not pure ASCII */
+void check_encoding( const char * const s, const long size )
+  {
+  const unsigned long long high = 0x8080808080808080ULL;
+  long i = 0;
+
+  if( nonascii_ ) return;
+  for( ; i + 8 <= size; i += 8 )
+    {
+    unsigned long long w;
+    memcpy( &w, s + i, 8 );
+    if( w & high ) { nonascii_ = true; return; }
+    }
+  for( ; i < size; ++i )
+    if( s[i] & 0x80 ) { nonascii_ = true; return; }
+  }
 
 bool modified( void ) { return modified_; }
 void set_modified( const bool m ) { modified_ = m; }
 
 
 int inc_addr( int addr )
-  { if( ++addr > last_addr_ ) addr = 0; return addr; }
+  { return ( addr < last_addr_upto( addr ) ) ? addr + 1 : 0; }
 
 int dec_addr( int addr )
-  { if( --addr < 0 ) addr = last_addr_; return addr; }
+  { if( --addr < 0 ) addr = last_addr(); return addr; }
 
 
 /* link next and previous nodes */
@@ -76,10 +159,11 @@ static void insert_node( line_t * const lp, line_t * const prev )
   }
 
 
-/* to be called before add_line_node */
-static bool too_many_lines( void )
+/* to be called before add_line_node, with the number of lines 'queued'
+   to be added before this one */
+static bool too_many_lines( const int queued )
   {
-  if( last_addr_ < INT_MAX - 1 ) return false;
+  if( last_addr_ < INT_MAX - 1 - queued ) return false;
   set_error_msg( "Too many lines in buffer" ); return true;
   }
 
@@ -87,16 +171,66 @@ static bool too_many_lines( void )
 static void add_line_node( line_t * const lp )
   {
   line_t * const prev = search_line_node( current_addr_ );
+  index_insert( lp, 1, current_addr_ );
   insert_node( lp, prev );
   ++current_addr_;
   ++last_addr_;
+  cached_lp = lp; cached_addr = current_addr_;
+  }
+
+
+/* return the address of a node in the editor buffer or of buffer_head */
+static int node_addr( const line_t * const lp )
+  { return ( lp == &buffer_head ) ? 0 : index_addr( lp ); }
+
+
+/* Line nodes are allocated from slabs, and freed nodes are kept in a
+   list linked through q_forw, so that a whole list of nodes can be freed
+   in O(1). The slabs are only released when the buffer is closed. */
+enum { slab_nodes = 4096 };
+
+typedef struct slab
+  {
+  struct slab * next;
+  line_t nodes[slab_nodes];
+  }
+slab_t;
+
+static slab_t * slabs = 0;
+static int slab_used = slab_nodes;	/* nodes used in the first slab */
+
+
+static line_t * alloc_line_node( void )
+  {
+  if( free_nodes )
+    { line_t * const lp = free_nodes; free_nodes = lp->q_forw; return lp; }
+  if( slab_used >= slab_nodes )
+    {
+    slab_t * const sp = (slab_t *) malloc( sizeof (slab_t) );
+    if( !sp ) return 0;
+    sp->next = slabs; slabs = sp; slab_used = 0; ++slabs_allocated;
+    }
+  return &slabs->nodes[slab_used++];
+  }
+
+
+/* free the list of nodes from 'first' to 'last' linked through q_forw */
+static void free_line_nodes( line_t * const first, line_t * const last )
+  { last->q_forw = free_nodes; free_nodes = first; }
+
+
+/* release all the slabs; to be called when no node is in use */
+static void free_slabs( void )
+  {
+  while( slabs ) { slab_t * const sp = slabs; slabs = sp->next; free( sp ); }
+  slab_used = slab_nodes; free_nodes = 0;
   }
 
 
 /* return a pointer to a copy of a line node, or to a new node if lp == 0 */
 static line_t * dup_line_node( line_t * const lp )
   {
-  line_t * const p = (line_t *) malloc( sizeof (line_t) );
+  line_t * const p = alloc_line_node();
   if( !p )
     {
     show_strerror( 0, errno );
@@ -104,10 +238,61 @@ static line_t * dup_line_node( line_t * const lp )
     return 0;
     }
   if( lp ) { p->pos = lp->pos; p->len = lp->len; }
+  p->t_left = p->t_right = p->t_parent = 0; p->t_size = 1;
+  p->flags = lp ? lp->flags & ~lf_active : 0;
   return p;
   }
 
 
+/* record in the journal the insertion of a line node after addr */
+static void journal_node( const int addr, const line_t * const lp )
+  {
+  const char * const s = journal_active() ? get_sbuf_text( lp ) : 0;
+  if( s ) journal_line( addr, s, lp->len );
+  }
+
+
+/* Add copies of the 'count' nodes starting at 'lp' after line 'addr', as
+   one run: the copies are made in one pass, then indexed and linked in at
+   once, and recorded by one undo atom. If error, the copies made before it
+   are added. Return false if error. */
+static bool add_line_copies( line_t * lp, const int count, const int addr,
+                             const bool journal )
+  {
+  line_t *first = 0, *last = 0;
+  int n = 0;
+  bool ok = true;
+
+  current_addr_ = addr;
+  disable_interrupts();
+  for( ; n < count; lp = lp->q_forw, ++n )
+    {
+    line_t * const p = too_many_lines( n ) ? 0 : dup_line_node( lp );
+    if( !p ) { ok = false; break; }
+    if( last ) link_nodes( last, p ); else first = p;
+    last = p;
+    }
+  if( n > 0 )
+    {
+    line_t * const prev = search_line_node( addr );
+    index_insert( first, n, addr );
+    link_nodes( last, prev->q_forw );
+    link_nodes( prev, first );
+    current_addr_ += n; last_addr_ += n;
+    cached_lp = last; cached_addr = current_addr_;
+    modified_ = true;
+    if( journal )
+      { lp = first;
+        for( int a = addr; a < current_addr_; ++a, lp = lp->q_forw )
+          journal_node( a, lp ); }
+    undo_t * const up = push_undo_atom( UADD, current_addr_, current_addr_ );
+    if( up ) up->head = first; else ok = false;
+    }
+  enable_interrupts();
+  return ok;
+  }
+
+
 /* Insert text from stdin (or from command buffer if global) to after
    line n; stop when either a single period is read or at EOF.
    Return false if insertion fails.
@@ -150,18 +335,15 @@ bool append_lines( const char ** const ibufpp, const int addr,
   }
 
 
-static void clear_yank_buffer( void )
+void clear_yank_buffer( void )
   {
-  line_t * lp = yank_buffer_head.q_forw;
-
   disable_interrupts();
-  while( lp != &yank_buffer_head )
+  if( yank_buffer_head.q_forw != &yank_buffer_head )
     {
-    line_t * const p = lp->q_forw;
-    link_nodes( lp->q_back, lp->q_forw );
-    free( lp );
-    lp = p;
+    free_line_nodes( yank_buffer_head.q_forw, yank_buffer_head.q_back );
+    link_nodes( &yank_buffer_head, &yank_buffer_head );
     }
+  yank_head = yank_tail = 0;
   enable_interrupts();
   }
 
@@ -170,7 +352,18 @@ static void clear_yank_buffer( void )
 bool close_sbuf( void )
   {
   clear_yank_buffer();
-  clear_undo_stack();
+  reset_undo_state();
+  lazy_src = -1;
+  while( nsources > 0 )			/* no line refers to them now */
+    {
+    source_t * const sp = &sources[--nsources];
+    munmap( (void *)sp->map, sp->size );
+    if( sp->fd >= 0 ) close( sp->fd );	/* releases the lease */
+    }
+  if( buffer_head.q_forw == &buffer_head ) free_slabs();
+  if( smap ) { munmap( smap, smap_size ); smap = 0; }
+  smap_size = smap_end = sfend = 0;
+  compact_check = compact_min;
   if( sfp )
     {
     if( fclose( sfp ) != 0 )
@@ -190,35 +383,10 @@ bool close_sbuf( void )
 /* copy a range of lines; return false if error */
 bool copy_lines( const int first_addr, const int second_addr, const int addr )
   {
-  line_t *lp, *np = search_line_node( first_addr );
-  undo_t * up = 0;
-  int n = second_addr - first_addr + 1;
-  int m = 0;
+  line_t * const lp = search_line_node( first_addr );
 
-  current_addr_ = addr;
-  if( addr >= first_addr && addr < second_addr )
-    {
-    n = addr - first_addr + 1;
-    m = second_addr - addr;
-    }
-  for( ; n > 0; n = m, m = 0, np = search_line_node( current_addr_ + 1 ) )
-    for( ; n-- > 0; np = np->q_forw )
-      {
-      if( too_many_lines() ) return false;
-      disable_interrupts();
-      lp = dup_line_node( np );
-      if( !lp ) { enable_interrupts(); return false; }
-      add_line_node( lp );
-      if( up ) up->tail = lp;
-      else
-        {
-        up = push_undo_atom( UADD, current_addr_, current_addr_ );
-        if( !up ) { enable_interrupts(); return false; }
-        }
-      modified_ = true;
-      enable_interrupts();
-      }
-  return true;
+  journal_copy( first_addr, second_addr, addr );
+  return add_line_copies( lp, second_addr - first_addr + 1, addr, false );
   }
 
 
@@ -226,14 +394,18 @@ bool copy_lines( const int first_addr, const int second_addr, const int addr )
 bool delete_lines( const int from, const int to, const bool isglobal )
   {
   line_t *n, *p;
+  undo_t * up;
 
-  if( !yank_lines( from, to ) ) return false;
+  clear_yank_buffer();
   disable_interrupts();
-  if( !push_undo_atom( UDEL, from, to ) )
-    { enable_interrupts(); return false; }
+  up = push_undo_atom( UDEL, from, to );
+  if( !up ) { enable_interrupts(); return false; }
+  yank_head = up->head; yank_tail = up->tail;	/* yanked by reference */
   n = search_line_node( inc_addr( to ) );
   p = search_line_node( from - 1 );	/* this search_line_node last! */
   if( isglobal ) unset_active_nodes( p->q_forw, n );
+  journal_delete( from, to );
+  index_remove( from, to );
   link_nodes( p, n );
   last_addr_ -= to - from + 1;
   current_addr_ = min( from, last_addr_ );
@@ -243,15 +415,28 @@ bool delete_lines( const int from, const int to, const bool isglobal )
   }
 
 
+/* Keep in the cut buffer only the last line deleted by delete_lines, as
+   if the lines had been deleted one at a time. */
+void yank_last_deleted_line( void )
+  { if( yank_head ) yank_head = yank_tail; }
+
+
 /* return line number of pointer */
 int get_line_node_addr( const line_t * const lp )
   {
-  const line_t * p = &buffer_head;
-  int addr = 0;
+  if( lp == &buffer_head ) return 0;
+  if( !index_contains( lp ) )
+    { if( last_addr_upto( 0 ) ) { invalid_address(); return -1; } return 0; }
+  return index_addr( lp );
+  }
 
-  while( p != lp && ( p = p->q_forw ) != &buffer_head ) ++addr;
-  if( addr && p == &buffer_head ) { invalid_address(); return -1; }
-  return addr;
+
+/* return a pointer to the text of a line of a source or of the mapping */
+static const char * mapped_text( const line_t * const lp )
+  {
+  if( lp->flags & lf_source )
+    return sources[lp->flags >> lf_source_shift].map + lp->pos;
+  return smap + lp->pos;
   }
 
 
@@ -263,11 +448,20 @@ char * get_sbuf_line( const line_t * const lp )
   int len;
 
   if( lp == &buffer_head ) return 0;
+  ++sb_reads; sb_read_bytes += lp->len;
+  if( use_mmap || ( lp->flags & lf_source ) )
+    {
+    len = lp->len;
+    if( !resize_buffer( &buf, &bufsz, len + 1 ) ) return 0;
+    memcpy( buf, mapped_text( lp ), len );
+    buf[len] = 0;
+    return buf;
+    }
   seek_write = true;			/* force seek on write */
   /* out of position */
   if( sfpos != lp->pos )
     {
-    sfpos = lp->pos;
+    sfpos = lp->pos; ++sb_seeks;
     if( fseek( sfp, sfpos, SEEK_SET ) != 0 )
       {
       show_strerror( 0, errno );
@@ -289,16 +483,74 @@ char * get_sbuf_line( const line_t * const lp )
   }
 
 
+/* return true if the text of every line is memory-mapped */
+bool sbuf_mapped( void ) { return use_mmap; }
+
+/* pointers to mapped text are invalid once this number changes */
+long sbuf_map_moves( void ) { return smap_moves; }
+
+
+/* If the text of a line is memory-mapped, return a pointer to it ( valid
+   while interrupts are disabled and no lines are added ), and set *fdp
+   and *offp to a file and offset from which the text can also be read,
+   or *fdp to -1. Return 0 if the text is not mapped. */
+const char * get_sbuf_mapped( const line_t * const lp, int * const fdp,
+                              long * const offp )
+  {
+  if( lp == &buffer_head ) return 0;
+  *offp = lp->pos;
+  if( lp->flags & lf_source )
+    {
+    const source_t * const sp = &sources[lp->flags >> lf_source_shift];
+    /* past 'same', the file was rewritten and the text was copied */
+    *fdp = ( lp->pos + lp->len < sp->same ) ? sp->fd : -1;
+    return mapped_text( lp );
+    }
+  if( !use_mmap ) return 0;
+  *fdp = fileno( sfp );
+  return mapped_text( lp );
+  }
+
+
+/* Return a pointer to the text of a line ( 'lp->len' bytes followed by a
+   newline, not by a NUL ). If the text is memory-mapped, this is a
+   pointer into the mapping, and no data are copied. The pointer is only
+   valid until the next call to get_sbuf_line or put_sbuf_line, and
+   interrupts must be disabled while using it ( SIGIO may grow the map ). */
+const char * get_sbuf_text( const line_t * const lp )
+  {
+  if( lp == &buffer_head ) return 0;
+  if( use_mmap || ( lp->flags & lf_source ) )
+    { ++sb_texts; return mapped_text( lp ); }
+  char * const s = get_sbuf_line( lp );
+  if( s ) s[lp->len] = '\n';
+  return s;
+  }
+
+
+static bool stdin_buffered = false;	/* stdin is a buffered regular file */
+
+/* Move the position of a buffered stdin back to the next char to be
+   read, so that shell commands and later readers of stdin start there. */
+void sync_stdin( void ) { if( stdin_buffered ) fflush( stdin ); }
+
+
 /* open scratch buffer; initialize line queue */
 bool init_buffers( void )
   {
+  struct stat st;
+
   /* Read stdin one character at a time to avoid i/o contention
      with shell escapes invoked by nonterminal input, e.g.,
      ed - <<EOF
      !cat
      hello, world
-     EOF */
-  setvbuf( stdin, 0, _IONBF, 0 );
+     EOF
+     A regular file can be read in blocks instead, because its position
+     can be restored by sync_stdin before running a shell command. */
+  if( fstat( 0, &st ) == 0 && S_ISREG( st.st_mode ) )
+    { stdin_buffered = true; atexit( sync_stdin ); }
+  else setvbuf( stdin, 0, _IONBF, 0 );
   if( !open_sbuf() ) return false;
   link_nodes( &buffer_head, &buffer_head );
   link_nodes( &yank_buffer_head, &yank_buffer_head );
@@ -311,18 +563,24 @@ bool join_lines( const int from, const int to, const bool isglobal )
   {
   static char * buf = 0;
   static int bufsz = 0;
-  int size = 0;
+  long size = 0;
   line_t * const ep = search_line_node( inc_addr( to ) );
-  line_t * bp = search_line_node( from );
+  line_t * bp;
 
-  while( bp != ep )
+  for( bp = search_line_node( from ); bp != ep; bp = bp->q_forw )
+    size += bp->len;
+  if( size > INT_MAX - 2 ) { set_error_msg( "Line too long" ); return false; }
+  if( !resize_buffer( &buf, &bufsz, size + 2 ) ) return false;
+  size = 0;
+  disable_interrupts();
+  for( bp = search_line_node( from ); bp != ep; bp = bp->q_forw )
     {
-    const char * const s = get_sbuf_line( bp );
-    if( !s || !resize_buffer( &buf, &bufsz, size + bp->len ) ) return false;
+    const char * const s = get_sbuf_text( bp );
+    if( !s ) { enable_interrupts(); return false; }
     memcpy( buf + size, s, bp->len );
     size += bp->len;
-    bp = bp->q_forw;
     }
+  enable_interrupts();
   if( !resize_buffer( &buf, &bufsz, size + 2 ) ) return false;
   buf[size++] = '\n';
   buf[size++] = 0;
@@ -370,6 +628,10 @@ bool move_lines( const int first_addr, const int second_addr, const int addr,
       b1 = search_line_node( p );	/* this search_line_node last! */
       }
     a2 = b2->q_forw;
+    journal_move( first_addr, second_addr, addr );
+    index_remove( first_addr, second_addr );
+    index_reinsert( b1->q_forw, ( addr < first_addr ) ? addr :
+                    addr - ( second_addr - first_addr + 1 ) );
     link_nodes( b2, b1->q_forw );
     link_nodes( a1->q_back, a2 );
     link_nodes( b1, a1 );
@@ -386,7 +648,8 @@ bool move_lines( const int first_addr, const int second_addr, const int addr,
 /* open scratch file */
 bool open_sbuf( void )
   {
-  isbinary_ = false; reset_unterminated_line();
+  isbinary_ = false; nonascii_ = false; reset_unterminated_line();
+  use_mmap = !stdio_scratch();
   sfp = tmpfile();
   if( !sfp )
     {
@@ -413,30 +676,313 @@ int path_max( const char * filename )
 /* append lines from the yank buffer */
 bool put_lines( const int addr )
   {
-  undo_t * up = 0;
-  line_t *p, *lp = yank_buffer_head.q_forw;
+  line_t * const lp = yank_head ? yank_head : yank_buffer_head.q_forw;
+  const line_t * const ep = yank_head ? yank_tail->q_forw : &yank_buffer_head;
+  int n = 0;
 
   if( lp == &yank_buffer_head )
     { set_error_msg( "Nothing to put" ); return false; }
-  current_addr_ = addr;
-  while( lp != &yank_buffer_head )
+  for( const line_t * p = lp; p != ep; p = p->q_forw ) ++n;
+  return add_line_copies( lp, n, addr, true );
+  }
+
+
+/* Enlarge the scratch file and its mapping to at least min_size bytes.
+   The file space is allocated in advance, so that running out of space
+   is reported here, instead of raising SIGBUS while copying the text. */
+static bool grow_smap( const long min_size )
+  {
+  long new_size = max( smap_size + smap_size / 2, 1L << 20 );
+  const long page = sysconf( _SC_PAGESIZE );
+  if( new_size < min_size ) new_size = min_size;
+  if( page > 0 ) new_size = ( new_size + page - 1 ) / page * page;
+  const int fd = fileno( sfp );
+  int errcode = posix_fallocate( fd, smap_size, new_size - smap_size );
+  if( errcode == 0 )
     {
-    if( too_many_lines() ) return false;
-    disable_interrupts();
-    p = dup_line_node( lp );
-    if( !p ) { enable_interrupts(); return false; }
-    add_line_node( p );
-    if( up ) up->tail = p;
+    void * p;
+#ifdef MREMAP_MAYMOVE
+    if( smap ) p = mremap( smap, smap_size, new_size, MREMAP_MAYMOVE );
     else
+#endif
+    p = mmap( 0, new_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+    if( p != MAP_FAILED )
       {
-      up = push_undo_atom( UADD, current_addr_, current_addr_ );
-      if( !up ) { enable_interrupts(); return false; }
+      if( smap && smap != p ) { munmap( smap, smap_size ); ++smap_moves; }
+      smap = (char *)p; smap_size = new_size; return true;
       }
-    modified_ = true;
-    lp = lp->q_forw;
-    enable_interrupts();
+    errcode = errno;
     }
-  return true;
+  show_strerror( 0, errcode );
+  set_error_msg( "Cannot write temp file" );
+  return false;
+  }
+
+
+/* Map a regular file to read its lines in place. A read lease is taken
+   on the file, so that ed is notified ( by SIGIO ) before anybody opens it
+   for writing, and can copy it to the scratch file in time.
+   Return the index of the new source, or -1 if the file can't be mapped
+   this way, in which case it must be read normally. */
+int map_source( const char * const filename, const char ** const textp,
+                long * const sizep )
+  {
+#ifdef F_SETLEASE
+  struct stat st;
+
+  if( nsources >= sources_max ) return -1;
+  const int fd = open( filename, O_RDONLY | O_CLOEXEC );
+  if( fd < 0 ) return -1;
+  catch_sigio();
+  if( fcntl( fd, F_SETLEASE, F_RDLCK ) == 0 &&	/* fails for non-files */
+      fstat( fd, &st ) == 0 && st.st_size > 0 &&
+      st.st_size < pos_limit )
+    {
+    void * const p = mmap( 0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    if( p != MAP_FAILED )
+      {
+      source_t * const sp = &sources[nsources];
+      sp->map = (const char *)p; sp->size = sp->same = st.st_size; sp->fd = fd;
+      sp->dev = st.st_dev; sp->ino = st.st_ino;
+      *textp = sp->map; *sizep = sp->size;
+      return nsources++;
+      }
+    }
+  close( fd );
+#endif
+  return -1;
+  }
+
+
+/* Copy a source, from the page containing offset 'from' to its end, to
+   the end of the scratch file, and map the copy at the address of the
+   source, so that existing pointers to its text ( and the line nodes
+   referring to it ) remain valid. */
+static bool copy_source( source_t * const sp, const long from )
+  {
+  const int fd = fileno( sfp );
+  const long page = sysconf( _SC_PAGESIZE );
+  const long start = from / page * page;
+  const long size = sp->size - start;
+  long pos;
+  bool ok;
+
+  if( size <= 0 ) return true;
+  if( use_mmap )
+    {
+    pos = ( smap_end + page - 1 ) / page * page;
+    if( pos + size > smap_size && !grow_smap( pos + size ) ) return false;
+    memcpy( smap + pos, sp->map + start, size );
+    smap_end = pos + size;
+    ok = true;
+    }
+  else
+    {
+    struct stat st;
+    ok = ( fflush( sfp ) == 0 && fstat( fd, &st ) == 0 );
+    pos = ok ? ( st.st_size + page - 1 ) / page * page : 0;
+    for( long done = 0; ok && done < size; )
+      {
+      const long n = pwrite( fd, sp->map + start + done, size - done,
+                             pos + done );
+      if( n > 0 ) done += n;
+      else if( n == 0 || errno != EINTR ) ok = false;
+      }
+    seek_write = true; sfpos = -1;		/* force seek on read and write */
+    if( ok ) sfend = pos + size;
+    }
+  if( ok && mmap( (void *)( sp->map + start ), size, PROT_READ,
+                  MAP_SHARED | MAP_FIXED, fd, pos ) != MAP_FAILED )
+    return true;
+  show_strerror( 0, errno );
+  set_error_msg( "Cannot write temp file" );
+  return false;
+  }
+
+
+/* Copy to the scratch file the sources that are about to be modified;
+   those being the same file as 'filename', or, if filename is 0, those
+   whose lease is being broken. Return false if error. */
+bool copy_sources( const char * const filename )
+  {
+  struct stat st;
+  bool ok = true;
+
+  if( filename && stat( filename, &st ) != 0 ) return true;
+  disable_interrupts();
+  for( int i = 0; i < nsources; ++i )
+    {
+    source_t * const sp = &sources[i];
+    if( sp->fd < 0 ) continue;
+#ifdef F_GETLEASE
+    if( filename ? sp->dev != st.st_dev || sp->ino != st.st_ino :
+                   fcntl( sp->fd, F_GETLEASE ) == F_RDLCK ) continue;
+#endif
+    if( !copy_source( sp, 0 ) ) ok = false;
+    close( sp->fd ); sp->fd = -1;		/* let the writer proceed */
+    }
+  enable_interrupts();
+  return ok;
+  }
+
+
+/* Return the index of the source mapping the file 'st', still leased,
+   and so unchanged since it was mapped or rewritten, whose start is the
+   same as the file in most bytes; or -1 if there is none. */
+int leased_source( const struct stat * const st )
+  {
+  int src = -1;
+
+  for( int i = 0; i < nsources; ++i )
+    if( sources[i].fd >= 0 && sources[i].dev == st->st_dev &&
+        sources[i].ino == st->st_ino &&
+        ( src < 0 || sources[i].same > sources[src].same ) ) src = i;
+  return src;
+  }
+
+
+/* Return the number of bytes at the start of source 'src' that are the
+   same as the text of lines 'from' to 'to', each followed by a newline,
+   and set *addrp to the first line not included in them. */
+long source_prefix( const int src, int from, const int to, int * const addrp )
+  {
+  const source_t * const sp = &sources[src];
+  const line_t * lp = search_line_node( from );
+  long pos = 0;
+
+  disable_interrupts();
+  for( ; from && from <= to; ++from, lp = lp->q_forw )
+    {
+    if( pos + lp->len >= sp->same || sp->map[pos+lp->len] != '\n' ) break;
+    if( !( lp->flags & lf_source ) || ( lp->flags >> lf_source_shift ) != src ||
+        lp->pos != pos )
+      {
+      const char * const s = get_sbuf_text( lp );
+      if( !s || memcmp( s, sp->map + pos, lp->len ) != 0 ) break;
+      }
+    pos += lp->len + 1;
+    }
+  enable_interrupts();
+  *addrp = from;
+  return pos;
+  }
+
+
+/* Prepare the file of source 'src' to be rewritten from offset 'pos' on:
+   copy the text of the source from there, and the other sources of the
+   file, to the scratch file. Then release the lease, so that the file can
+   be opened for writing. Return the leased descriptor, to be passed to
+   renew_source_lease when done, or -1 if error. */
+int unlease_source( const int src, const long pos )
+  {
+  source_t * const sp = &sources[src];
+  const int fd = sp->fd;
+  bool ok = true;
+
+  disable_interrupts();
+  for( int i = 0; i < nsources; ++i )
+    {
+    source_t * const p = &sources[i];
+    if( i == src || p->fd < 0 || p->dev != sp->dev || p->ino != sp->ino )
+      continue;
+    if( !copy_source( p, 0 ) ) ok = false;
+    close( p->fd ); p->fd = -1;
+    }
+  if( ok ) ok = copy_source( sp, pos );
+#ifdef F_SETLEASE
+  if( ok && fcntl( fd, F_SETLEASE, F_UNLCK ) != 0 )
+    { show_strerror( 0, errno ); set_error_msg( "Cannot write file" );
+      ok = false; }
+#endif
+  if( ok ) { sp->fd = -1; sp->same = pos; }	/* not read from the file */
+  enable_interrupts();
+  return ok ? fd : -1;
+  }
+
+
+/* Take the lease of source 'src' again on 'fd' after rewriting its file.
+   If someone else has opened the file meanwhile, copy the rest of the
+   source to the scratch file. Return false if error. */
+bool renew_source_lease( const int src, const int fd )
+  {
+  source_t * const sp = &sources[src];
+  bool ok = true;
+
+  disable_interrupts();
+#ifdef F_SETLEASE
+  if( fcntl( fd, F_SETLEASE, F_RDLCK ) == 0 ) sp->fd = fd;
+  else
+#endif
+    { ok = copy_source( sp, 0 ); close( fd ); }
+  enable_interrupts();
+  return ok;
+  }
+
+
+/* Write a block of complete lines to the scratch file and add a line node
+   for each of them to the editor buffer.
+   The text is stored with its newlines, so that consecutive lines are
+   contiguous in the scratch file. Any text after the last newline is
+   ignored. Return false if error.
+*/
+bool put_sbuf_lines( const char * const buf, const long size )
+  {
+  const char * const p = (const char *) memrchr( buf, '\n', size );
+  if( !p )
+    { set_error_msg( "internal error: unterminated line passed to put_sbuf_line" );
+      return false; }
+  const long bsize = p + 1 - buf;		/* size of the block */
+  const int addr = current_addr_;
+  long pos;					/* position of the block */
+
+  ++sb_writes; sb_write_bytes += bsize;
+  check_encoding( buf, bsize );
+  if( use_mmap )
+    {
+    if( smap_end + bsize > smap_size && !grow_smap( smap_end + bsize ) )
+      return false;
+    memcpy( smap + smap_end, buf, bsize );
+    pos = smap_end; smap_end += bsize;
+    }
+  else
+    {
+    if( seek_write )				/* out of position */
+      {
+      ++sb_seeks;
+      if( fseek( sfp, 0L, SEEK_END ) != 0 )
+        {
+        show_strerror( 0, errno );
+        set_error_msg( "Cannot seek temp file" );
+        return false;
+        }
+      sfpos = ftell( sfp );
+      seek_write = false;
+      }
+    if( (long)fwrite( buf, 1, bsize, sfp ) != bsize )	/* assert: interrupts disabled */
+      {
+      sfpos = -1;
+      show_strerror( 0, errno );
+      set_error_msg( "Cannot write temp file" );
+      return false;
+      }
+    pos = sfpos; sfpos += bsize;		/* update file position */
+    sfend = sfpos;
+    }
+  if( pos + bsize > pos_limit )
+    { set_error_msg( "Scratch file too big" ); return false; }
+  long i = 0;
+  while( i < bsize )
+    {
+    const char * const q = (const char *) memchr( buf + i, '\n', bsize - i );
+    const int len = q - ( buf + i );
+    line_t * const lp = too_many_lines( 0 ) ? 0 : dup_line_node( 0 );
+    if( !lp ) break;
+    lp->pos = pos + i; lp->len = len;
+    add_line_node( lp );
+    i += len + 1;
+    }
+  journal_text( addr, buf, i );			/* the lines added */
+  return i >= bsize;
   }
 
 
@@ -451,58 +997,110 @@ const char * put_sbuf_line( const char * const buf, const int size )
   if( !p )
     { set_error_msg( "internal error: unterminated line passed to put_sbuf_line" );
       return 0; }
-  const int len = p - buf;
-  if( too_many_lines() ) return 0;
+  return put_sbuf_lines( buf, p + 1 - buf ) ? p + 1 : 0;
+  }
 
-  if( seek_write )				/* out of position */
-    {
-    if( fseek( sfp, 0L, SEEK_END ) != 0 )
-      {
-      show_strerror( 0, errno );
-      set_error_msg( "Cannot seek temp file" );
-      return 0;
-      }
-    sfpos = ftell( sfp );
-    seek_write = false;
-    }
-  if( (int)fwrite( buf, 1, len, sfp ) != len )	/* assert: interrupts disabled */
-    {
-    sfpos = -1;
-    show_strerror( 0, errno );
-    set_error_msg( "Cannot write temp file" );
-    return 0;
-    }
-  line_t * lp = dup_line_node( 0 );
-  if( !lp ) return 0;
-  lp->pos = sfpos; lp->len = len;
+
+/* add a line node for a line of text in the given source */
+bool put_source_line( const int src, const long pos, const int len )
+  {
+  if( too_many_lines( 0 ) ) return false;
+  line_t * const lp = dup_line_node( 0 );
+  if( !lp ) return false;
+  lp->pos = pos; lp->len = len;
+  lp->flags = lf_source | ( src << lf_source_shift );
   add_line_node( lp );
-  sfpos += len;				/* update file position */
-  return p + 1;
+  journal_node( current_addr_ - 1, lp );
+  return true;
   }
 
 
-/* return pointer to a line node in the editor buffer */
-line_t * search_line_node( const int addr )
+/* Read the lines of a source lazily into the empty buffer, as they are
+   needed. The source must end with a newline. The current address is the
+   last line, whose address is not computed until it is needed. */
+void read_lazily( const int src )
+  {
+  lazy_src = src; lazy_pos = 0; lazy_lines = 0;
+  current_addr_ = lazy_last;
+  }
+
+
+/* Drop the lines of the file read lazily not yet indexed, before the
+   buffer is emptied. */
+void discard_lazy_lines( void )
   {
-  static line_t * lp = &buffer_head;
-  static int o_addr = 0;
+  lazy_src = -1;
+  if( current_addr_ == lazy_last ) current_addr_ = last_addr_;
+  }
+
+
+/* Index the lines of the lazy source until 'addr' exists, and a batch
+   more. The lines are added after the last line of the buffer without
+   being recorded for undo or in the journal, as they have been in the
+   buffer since the file was read. If a line can't be indexed, the rest
+   of the file is dropped from the buffer. */
+static void index_lazy_lines( const int addr )
+  {
+  enum { lazy_batch = 4096 };
+  const source_t * const sp = &sources[lazy_src];
+  const long target = (long)addr + lazy_batch;
+  const int o_current_addr = current_addr_;
+  const int o_last_addr = last_addr_;
 
   disable_interrupts();
-  if( o_addr < addr )
+  current_addr_ = last_addr_;
+  while( last_addr_ < target && lazy_pos < sp->size )
     {
-    if( o_addr + last_addr_ >= 2 * addr )
-      while( o_addr < addr ) { ++o_addr; lp = lp->q_forw; }
-    else
+    const char * const s = sp->map + lazy_pos;
+    const long len =
+      (const char *) memchr( s, '\n', sp->size - lazy_pos ) - s;
+    line_t * const lp = ( len >= INT_MAX ) ? 0 :
+                        too_many_lines( 0 ) ? 0 : dup_line_node( 0 );
+    if( !lp )
       {
-      lp = buffer_head.q_back; o_addr = last_addr_;
-      while( o_addr > addr ) { --o_addr; lp = lp->q_back; }
+      fputs( "Input file truncated; its last lines can't be indexed\n", stderr );
+      modified_ = true; lazy_pos = sp->size; break;
       }
+    lp->pos = lazy_pos; lp->len = len;
+    lp->flags = lf_source | ( lazy_src << lf_source_shift );
+    add_line_node( lp );
+    if( !isbinary_ && memchr( s, 0, len ) ) isbinary_ = true;
+    check_encoding( s, len );
+    lazy_pos += len + 1;
     }
-  else if( o_addr <= 2 * addr )
-    while( o_addr > addr ) { --o_addr; lp = lp->q_back; }
-  else
-    { lp = &buffer_head; o_addr = 0;
+  if( lazy_pos >= sp->size ) lazy_src = -1;
+  lazy_lines += last_addr_ - o_last_addr;
+  current_addr_ = o_current_addr;
+  enable_interrupts();
+  }
+
+
+/* Return pointer to a line node in the editor buffer.
+   Short distances from the last line searched or from the ends of the
+   buffer are walked; longer ones are looked up in the line index. */
+line_t * search_line_node( const int addr )
+  {
+  enum { walk_max = 32 };	/* max nodes to walk instead of lookup */
+  line_t * lp = cached_lp;
+  int o_addr = cached_addr;
+
+  disable_interrupts();
+  ++ln_searches;
+  if( addr <= 0 ) { lp = &buffer_head; o_addr = 0; }
+  else if( o_addr <= addr && addr - o_addr <= walk_max )
+    { ln_steps += addr - o_addr;
+      while( o_addr < addr ) { ++o_addr; lp = lp->q_forw; } }
+  else if( o_addr > addr && o_addr - addr <= walk_max )
+    { ln_steps += o_addr - addr;
+      while( o_addr > addr ) { --o_addr; lp = lp->q_back; } }
+  else if( addr <= walk_max )
+    { lp = &buffer_head; o_addr = 0; ln_steps += addr;
       while( o_addr < addr ) { ++o_addr; lp = lp->q_forw; } }
+  else if( last_addr_ - addr <= walk_max )
+    { lp = buffer_head.q_back; o_addr = last_addr_; ln_steps += o_addr - addr;
+      while( o_addr > addr ) { --o_addr; lp = lp->q_back; } }
+  else { lp = index_node( addr ); o_addr = addr; ++ln_lookups; }
+  cached_lp = lp; cached_addr = o_addr;
   enable_interrupts();
   return lp;
   }
@@ -530,111 +1128,260 @@ bool yank_lines( const int from, const int to )
   }
 
 
-static undo_t * ustack = 0;		/* undo stack */
-static int usize = 0;			/* ustack size (in bytes) */
-static int u_idx = 0;			/* undo stack index */
-static int u_current_addr = -1;		/* if < 0, undo disabled */
-static int u_last_addr = -1;		/* if < 0, undo disabled */
-static bool u_modified = false;
+/* Copy the lines referenced by the cut buffer, before undo links them
+   back into the editor buffer. */
+static bool copy_yanked_lines( void )
+  {
+  line_t * const ep = yank_tail->q_forw;
+  line_t * bp = yank_head;
+  line_t * lp = &yank_buffer_head;
+  line_t * p;
+
+  disable_interrupts();
+  yank_head = yank_tail = 0;
+  while( bp != ep )
+    {
+    p = dup_line_node( bp );
+    if( !p ) { clear_yank_buffer(); enable_interrupts(); return false; }
+    insert_node( p, lp );
+    bp = bp->q_forw; lp = p;
+    }
+  enable_interrupts();
+  return true;
+  }
+
+
+/* The undo journal. Each command that may change the buffer opens a
+   level, which records the changes made by the command as a stack of
+   atoms ( runs of line nodes added, deleted or moved ). The nodes of the
+   deleted lines are kept by the level, and their text stays in the
+   scratch file. Undoing or redoing a level reverses its atoms and swaps
+   its saved state with the current one, in time proportional to the size
+   of the change. Levels [0,u_level) may be undone, the rest redone. With
+   one level ( the default ) 'u' undoes and redoes the last command.
+   Old levels are dropped when there are more than 'undo_levels', or when
+   their nodes and atoms take more than 'undo_memory' bytes. */
 
+typedef struct
+  {
+  undo_t * atoms;
+  int n;				/* number of atoms */
+  long size;				/* atoms size (in bytes) */
+  long held;				/* memory held by the level */
+  int current_addr;			/* if < 0, undo disabled */
+  int last_addr;
+  int lazy_lines;			/* lines indexed lazily at last_addr */
+  bool modified;
+  }
+ulevel_t;
 
-void clear_undo_stack( void )
+static ulevel_t * ulevels = 0;		/* undo journal, oldest level first */
+static int ulevels_size = 0;		/* ulevels size (in levels) */
+static int u_nlevels = 0;		/* number of levels in the journal */
+static int u_level = 0;			/* number of levels that may be undone */
+static long u_held = 0;			/* memory held by all the levels */
+static int undo_levels = 1;		/* max number of levels kept */
+static long undo_memory = 64L << 20;	/* max memory held by old levels */
+static undo_t * spare_atoms = 0;	/* atoms of a freed level, for reuse */
+static long spare_size = 0;
+
+
+void set_undo_levels( const int n ) { undo_levels = n; }
+void set_undo_memory( const long bytes ) { undo_memory = bytes; }
+bool multilevel_undo( void ) { return undo_levels > 1; }
+
+/* return a count that grows with every change of the editor buffer */
+long buffer_changes( void ) { return undo_atoms; }
+
+
+/* free the nodes of the lines held by a level, and its atoms */
+static void free_level( ulevel_t * const lv )
   {
-  while( u_idx-- )
-    if( ustack[u_idx].type == UDEL )
-      {
-      line_t * const ep = ustack[u_idx].tail->q_forw;
-      line_t * bp = ustack[u_idx].head;
-      while( bp != ep )
-        {
-        line_t * const lp = bp->q_forw;
-        unmark_line_node( bp );
-        unmark_unterminated_line( bp );
-        free( bp );
-        bp = lp;
-        }
+  bool unmarked = false;
+
+  while( lv->n-- )			/* an empty range has head == tail->q_forw */
+    {
+    const undo_t * const up = &lv->atoms[lv->n];
+    if( up->type != UDEL || up->head == up->tail->q_forw ) continue;
+    if( !unmarked )			/* before any node is freed */
+      { unmark_deleted_nodes(); unmark_deleted_unterminated_line();
+        unmarked = true; }
+    if( yank_head && up->tail == yank_tail )
+      {					/* hand them to the cut buffer */
+      if( up->head != yank_head ) free_line_nodes( up->head, yank_head->q_back );
+      link_nodes( &yank_buffer_head, yank_head );
+      link_nodes( yank_tail, &yank_buffer_head );
+      yank_head = yank_tail = 0;
       }
-  u_idx = 0;
-  u_current_addr = current_addr_;
-  u_last_addr = last_addr_;
-  u_modified = modified_;
+    else free_line_nodes( up->head, up->tail );
+    }
+  u_held -= lv->held;
+  if( lv->size > spare_size )
+    { free( spare_atoms ); spare_atoms = lv->atoms; spare_size = lv->size; }
+  else free( lv->atoms );
+  lv->atoms = 0; lv->n = lv->size = 0; lv->held = 0;
   }
 
 
-void reset_undo_state( void )
+/* free the levels that may be redone */
+static void free_redo_levels( void )
+  {
+  while( u_nlevels > u_level ) free_level( &ulevels[--u_nlevels] );
+  }
+
+
+static void drop_oldest_level( void )
   {
-  clear_undo_stack();
-  u_current_addr = u_last_addr = -1;
-  u_modified = false;
+  free_level( &ulevels[0] );
+  memmove( ulevels, ulevels + 1, --u_nlevels * sizeof (ulevel_t) );
+  if( u_level > 0 ) --u_level;
   }
 
 
-static void free_undo_stack( void )
+/* open a new level on top of the journal; return false if error */
+static bool open_level( const int o_current_addr, const int o_last_addr,
+                        const bool o_modified )
   {
-  if( ustack )
+  if( u_nlevels >= ulevels_size )
     {
-    clear_undo_stack();
-    free( ustack );
-    ustack = 0;
-    usize = u_idx = 0;
-    u_current_addr = u_last_addr = -1;
+    const int new_size = ( ulevels_size < 8 ) ? 8 : 2 * ulevels_size;
+    void * const new_buf = realloc( ulevels, new_size * sizeof (ulevel_t) );
+    if( !new_buf )
+      { show_strerror( 0, errno ); set_error_msg( mem_msg ); return false; }
+    ulevels_size = new_size;
+    ulevels = (ulevel_t *)new_buf;
     }
+  ulevel_t * const lv = &ulevels[u_nlevels++];
+  lv->atoms = spare_atoms; lv->size = spare_size;
+  spare_atoms = 0; spare_size = 0;
+  lv->n = 0; lv->held = 0;
+  lv->current_addr = o_current_addr;
+  lv->last_addr = o_last_addr;
+  lv->lazy_lines = lazy_lines;
+  lv->modified = o_modified;
+  u_level = u_nlevels;
+  return true;
+  }
+
+
+/* open the level of the next command, dropping the levels that may be
+   redone, a previous level that recorded nothing, and the old levels that
+   exceed the limits */
+void clear_undo_stack( void )
+  {
+  disable_interrupts();
+  free_redo_levels();
+  if( u_nlevels > 0 && ( ulevels[u_nlevels-1].n == 0 ||
+                         ulevels[u_nlevels-1].current_addr < 0 ) )
+    { free_level( &ulevels[--u_nlevels] ); u_level = u_nlevels; }
+  while( u_nlevels > 0 &&
+         ( u_nlevels >= undo_levels || u_held > undo_memory ) )
+    drop_oldest_level();
+  open_level( current_addr_, last_addr_, modified_ );
+  enable_interrupts();
+  }
+
+
+/* empty the journal; undo is disabled until the next command */
+void reset_undo_state( void )
+  {
+  disable_interrupts();
+  u_level = 0;
+  free_redo_levels();
+  enable_interrupts();
+  }
+
+
+static void free_undo_journal( void )
+  {
+  reset_undo_state();
+  free( spare_atoms ); spare_atoms = 0; spare_size = 0;
   }
 
 
 /* return pointer to intialized undo node */
 undo_t * push_undo_atom( const int type, const int from, const int to )
   {
-  const unsigned min_size = ( u_idx + 1 ) * sizeof (undo_t);
-
   disable_interrupts();
-  if( (unsigned)usize < min_size )
+  if( u_nlevels == 0 || ( undo_levels > 1 && u_level < u_nlevels ) )
+    {				/* no level open, or a change after an undo */
+    const bool enabled = ( u_nlevels > 0 );
+    free_redo_levels();
+    if( !open_level( enabled ? current_addr_ : -1, last_addr_, modified_ ) )
+      { enable_interrupts(); return 0; }
+    }
+  ulevel_t * const lv = &ulevels[u_nlevels-1];
+  const long min_size = ( lv->n + 1L ) * sizeof (undo_t);
+  if( lv->size < min_size )
     {
-    if( min_size >= INT_MAX )
+    if( lv->n >= INT_MAX - 1 )
       { set_error_msg( "Undo stack too long" );
-        free_undo_stack(); enable_interrupts(); return 0; }
-    const int new_size = ( ( min_size < 512 ) ? 512 :
-      ( min_size > INT_MAX / 2 ) ? INT_MAX : ( min_size / 512 ) * 1024 );
+        free_undo_journal(); enable_interrupts(); return 0; }
+    const long new_size = ( min_size < 512 ) ? 512 : ( min_size / 512 ) * 1024;
     void * new_buf = 0;
-    if( ustack ) new_buf = realloc( ustack, new_size );
+    if( lv->atoms ) new_buf = realloc( lv->atoms, new_size );
     else new_buf = malloc( new_size );
     if( !new_buf )
       { show_strerror( 0, errno ); set_error_msg( mem_msg );
-        free_undo_stack(); enable_interrupts(); return 0; }
-    usize = new_size;
-    ustack = (undo_t *)new_buf;
+        free_undo_journal(); enable_interrupts(); return 0; }
+    lv->size = new_size;
+    lv->atoms = (undo_t *)new_buf;
     }
-  ustack[u_idx].type = (Atom) type;
-  ustack[u_idx].tail = search_line_node( to );
-  ustack[u_idx].head = search_line_node( from );
+  undo_t * const up = &lv->atoms[lv->n++];
+  ++undo_atoms;
+  up->type = (Atom) type;
+  up->tail = search_line_node( to );
+  up->head = search_line_node( from );
+  const long held = sizeof (undo_t) +
+    ( ( type == UDEL && to >= from ) ? ( to - from + 1L ) * sizeof (line_t) : 0 );
+  lv->held += held; u_held += held;
   enable_interrupts();
-  return ustack + u_idx++;
+  return up;
   }
 
 
-/* undo last change to the editor buffer */
-bool undo( const bool isglobal )
+/* undo or redo the changes recorded by a level */
+static bool reverse_level( ulevel_t * const lv, const bool isglobal )
   {
+  undo_t * const ustack = lv->atoms;
+  const int u_idx = lv->n;
   int n;
   const int o_current_addr = current_addr_;
   const int o_last_addr = last_addr_;
   const bool o_modified = modified_;
 
-  if( u_idx <= 0 || u_current_addr < 0 || u_last_addr < 0 )
-    { set_error_msg( "Nothing to undo" ); return false; }
+  if( yank_head && !copy_yanked_lines() ) return false;
   search_line_node( 0 );		/* reset cached value */
   disable_interrupts();
   for( n = u_idx - 1; n >= 0; --n )
     {
+    const line_t * lp;
+    int from, to, addr;
     switch( ustack[n].type )
       {
-      case UADD: link_nodes( ustack[n].head->q_back, ustack[n].tail->q_forw );
+      case UADD: from = index_addr( ustack[n].head );
+                 to = index_addr( ustack[n].tail );
+                 journal_delete( from, to );
+                 index_remove( from, to );
+                 link_nodes( ustack[n].head->q_back, ustack[n].tail->q_forw );
                  break;
-      case UDEL: link_nodes( ustack[n].head->q_back, ustack[n].head );
+      case UDEL: addr = node_addr( ustack[n].head->q_back );
+                 index_reinsert( ustack[n].head, addr );
+                 link_nodes( ustack[n].head->q_back, ustack[n].head );
                  link_nodes( ustack[n].tail, ustack[n].tail->q_forw );
+                 if( ustack[n].head != ustack[n].tail->q_forw )
+                   for( lp = ustack[n].head; ; lp = lp->q_forw )
+                     { journal_node( addr++, lp );
+                       if( lp == ustack[n].tail ) break; }
                  break;
       case UMOV:
-      case VMOV: link_nodes( ustack[n-1].head, ustack[n].head->q_forw );
+      case VMOV: from = index_addr( ustack[n].head->q_forw );
+                 to = index_addr( ustack[n].tail->q_back );
+                 journal_move( from, to, node_addr( ustack[n-1].head ) );
+                 index_remove( from, to );
+                 index_reinsert( ustack[n].head->q_forw,
+                                 node_addr( ustack[n-1].head ) );
+                 link_nodes( ustack[n-1].head, ustack[n].head->q_forw );
                  link_nodes( ustack[n].tail->q_back, ustack[n-1].tail );
                  link_nodes( ustack[n].head, ustack[n].tail ); --n;
                  break;
@@ -648,9 +1395,195 @@ bool undo( const bool isglobal )
     ustack[n] = ustack[u_idx-1-n]; ustack[u_idx-1-n] = tmp;
     }
   if( isglobal ) clear_active_list();
-  current_addr_ = u_current_addr; u_current_addr = o_current_addr;
-  last_addr_ = u_last_addr; u_last_addr = o_last_addr;
-  modified_ = u_modified; u_modified = o_modified;
+  current_addr_ = lv->current_addr; lv->current_addr = o_current_addr;
+  last_addr_ = lv->last_addr + ( lazy_lines - lv->lazy_lines );
+  lv->last_addr = o_last_addr; lv->lazy_lines = lazy_lines;
+  modified_ = lv->modified; lv->modified = o_modified;
   enable_interrupts();
   return true;
   }
+
+
+/* Undo last change to the editor buffer. With one level, undo the last
+   undo. */
+bool undo( const bool isglobal )
+  {
+  if( undo_levels > 1 && u_level > 0 && u_level == u_nlevels &&
+      ulevels[u_level-1].n == 0 )	/* the last command changed nothing */
+    { disable_interrupts(); free_level( &ulevels[--u_nlevels] );
+      u_level = u_nlevels; enable_interrupts(); }
+  const int k = ( undo_levels > 1 ) ? u_level - 1 : u_nlevels - 1;
+  if( k < 0 || ulevels[k].n <= 0 || ulevels[k].current_addr < 0 ||
+      ulevels[k].last_addr < 0 )
+    { set_error_msg( "Nothing to undo" ); return false; }
+  if( !reverse_level( &ulevels[k], isglobal ) ) return false;
+  u_level = ( undo_levels > 1 ) ? k : u_nlevels - u_level;
+  return true;
+  }
+
+
+/* redo the last change undone */
+bool redo( const bool isglobal )
+  {
+  if( u_level >= u_nlevels )
+    { set_error_msg( "Nothing to redo" ); return false; }
+  if( !reverse_level( &ulevels[u_level], isglobal ) ) return false;
+  ++u_level;
+  return true;
+  }
+
+
+/* Scratch file compaction.
+   The text of deleted or replaced lines is never overwritten, so the
+   scratch file only grows. When the text that no line node refers to
+   ( in the editor buffer, in the undo stack or in the cut buffer ) is
+   larger than the text still in use, the text in use is copied in buffer
+   order to a new scratch file, which replaces the old one. */
+
+static FILE * cfp = 0;		/* new scratch file */
+static char * cmap = 0;		/* mapping of the new scratch file */
+static long cpos = 0;		/* size of the text copied so far */
+static long run_pos = 0;	/* position and size in the old file */
+static long run_len = 0;	/* of the run of text being copied */
+
+
+/* call fn for each line node in use whose text is in the scratch file */
+static bool for_each_sbuf_line( bool (* const fn)( line_t * const lp ) )
+  {
+  line_t * lp;
+
+  for( lp = buffer_head.q_forw; lp != &buffer_head; lp = lp->q_forw )
+    if( !( lp->flags & lf_source ) && !fn( lp ) ) return false;
+  for( int k = 0; k < u_nlevels; ++k )
+    for( int i = 0; i < ulevels[k].n; ++i )
+      {				/* an empty range has head == tail->q_forw */
+      const undo_t * const up = &ulevels[k].atoms[i];
+      if( up->type == UDEL && up->head != up->tail->q_forw )
+        for( lp = up->head; ; lp = lp->q_forw )
+          {
+          if( !( lp->flags & lf_source ) && !fn( lp ) ) return false;
+          if( lp == up->tail ) break;
+          }
+      }
+  for( lp = yank_buffer_head.q_forw; lp != &yank_buffer_head; lp = lp->q_forw )
+    if( !( lp->flags & lf_source ) && !fn( lp ) ) return false;
+  return true;
+  }
+
+
+static bool count_line( line_t * const lp )
+  { cpos += lp->len + 1; return true; }
+
+
+static bool move_line( line_t * const lp )
+  { lp->pos = cpos; cpos += lp->len + 1; return true; }
+
+
+/* copy the current run of text to the new scratch file */
+static bool copy_run( void )
+  {
+  if( cmap ) memcpy( cmap + cpos, smap + run_pos, run_len );
+  else
+    {
+    char buf[65536];
+    for( long done = 0; done < run_len; )
+      {
+      const long n = pread( fileno( sfp ), buf,
+                            min( run_len - done, (long)sizeof buf ),
+                            run_pos + done );
+      if( n < 0 && errno == EINTR ) continue;
+      if( n <= 0 || (long)fwrite( buf, 1, n, cfp ) != n ) return false;
+      done += n;
+      }
+    }
+  cpos += run_len; run_len = 0;
+  return true;
+  }
+
+
+static bool copy_line( line_t * const lp )
+  {
+  if( run_len > 0 && lp->pos == run_pos + run_len )
+    { run_len += lp->len + 1; return true; }
+  if( run_len > 0 && !copy_run() ) return false;
+  run_pos = lp->pos; run_len = lp->len + 1;
+  return true;
+  }
+
+
+/* Copy 'size' bytes of text in use to a new scratch file. Return false
+   if error, leaving the current scratch file untouched. */
+static bool copy_live_text( const long size )
+  {
+  const long page = sysconf( _SC_PAGESIZE );
+  long msize = max( size, 1L << 20 );
+
+  cfp = tmpfile(); cmap = 0; cpos = run_len = 0;
+  if( !cfp ) return false;
+  if( use_mmap )
+    {
+    if( page > 0 ) msize = ( msize + page - 1 ) / page * page;
+    void * p = MAP_FAILED;
+    if( posix_fallocate( fileno( cfp ), 0, msize ) == 0 )
+      p = mmap( 0, msize, PROT_READ | PROT_WRITE, MAP_SHARED, fileno( cfp ), 0 );
+    if( p == MAP_FAILED ) { fclose( cfp ); return false; }
+    cmap = (char *)p;
+    }
+  else if( fflush( sfp ) != 0 ) { fclose( cfp ); return false; }
+  if( !for_each_sbuf_line( copy_line ) || ( run_len > 0 && !copy_run() ) ||
+      ( !cmap && fflush( cfp ) != 0 ) )
+    {
+    if( cmap ) munmap( cmap, msize );
+    fclose( cfp ); return false;
+    }
+  cpos = 0; for_each_sbuf_line( move_line );	/* can't fail */
+  fclose( sfp ); sfp = cfp;
+  if( cmap )
+    { munmap( smap, smap_size ); smap = cmap; smap_size = msize;
+      smap_end = size; }
+  else { sfend = size; seek_write = true; sfpos = -1; }
+  return true;
+  }
+
+
+/* Compact the scratch file if enough of its text is no longer in use.
+   To be called between commands. A failed compaction is not an error;
+   it is just not retried until the scratch file grows further.
+   Sources copied to the scratch file prevent compaction. */
+void compact_sbuf( void )
+  {
+  const long size = use_mmap ? smap_end : sfend;
+
+  if( size < compact_check || !sfp ) return;
+  for( int i = 0; i < nsources; ++i )
+    if( sources[i].fd < 0 ) return;
+  disable_interrupts();
+  cpos = 0; for_each_sbuf_line( count_line );
+  const long live = cpos;
+  compact_check = 2 * live + compact_min;	/* dead text > live + min */
+  if( size >= compact_check )
+    {
+    if( copy_live_text( live ) )
+      { ++compactions; reclaimed += size - live; }
+    else compact_check = 2 * size + compact_min;
+    }
+  enable_interrupts();
+  }
+
+
+void print_sbuf_stats( void )
+  {
+  const long size = use_mmap ? smap_end : sfend;
+
+  cpos = 0; for_each_sbuf_line( count_line );
+  fprintf( stderr, "scratch: %ld bytes, %ld in use, %d compactions, "
+           "%ld bytes reclaimed\n", size, cpos, compactions, reclaimed );
+  fprintf( stderr, "scratch io: %ld lines copied ( %ld bytes ), %ld read in "
+           "place, %ld blocks written ( %ld bytes ), %ld seeks\n", sb_reads,
+           sb_read_bytes, sb_texts, sb_writes, sb_write_bytes, sb_seeks );
+  fprintf( stderr, "line search: %ld searches, %ld nodes walked, "
+           "%ld index lookups\n", ln_searches, ln_steps, ln_lookups );
+  fprintf( stderr, "memory: %ld line node slabs ( %ld bytes ), "
+           "%ld undo atoms pushed\n", slabs_allocated,
+           slabs_allocated * (long)sizeof (slab_t), undo_atoms );
+  }
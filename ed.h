@@ -22,6 +22,13 @@ enum Bool { false = 0, true = 1 };
 typedef enum Bool bool;
 #endif
 
+enum Lflags			/* line node flags */
+  {
+  lf_active = 0x01,		/* line is in the global-active list */
+  lf_source = 0x02,		/* text is in a mapped input file */
+  lf_source_shift = 8		/* flags >> lf_source_shift = input file ( < 32 ) */
+  };
+
 enum Pflags			/* print suffixes */
   {
   pf_l = 0x01,			/* list after command */
@@ -29,13 +36,27 @@ enum Pflags			/* print suffixes */
   pf_p = 0x04			/* print after command */
   };
 
+enum Matcher			/* regex matcher selected by --regex-matcher */
+  {
+  rm_auto = 0,			/* bytes if buffer and pattern are ASCII */
+  rm_locale,			/* the matcher of the locale */
+  rm_bytes			/* single-byte matcher of the C locale */
+  };
+
 
+/* Addresses and line counts are ints, so the buffer holds at most
+   INT_MAX - 2 lines. Text positions have 48 bits ( 128 TiB ). */
 typedef struct line		/* Line node */
   {
   struct line * q_forw;
   struct line * q_back;
-  long pos;			/* position of text in scratch buffer */
+  struct line * t_left;		/* line index tree links */
+  struct line * t_right;
+  struct line * t_parent;
+  long pos : 48;		/* position of text in scratch buffer or source */
+  unsigned flags : 16;		/* Lflags, packed with pos in 8 bytes */
   int len;			/* length of line ('\n' is not stored) */
+  int t_size;			/* number of nodes in index subtree */
   }
 line_t;
 
@@ -62,72 +83,138 @@ static const char * const no_prev_subst = "No previous substitution";
 /* defined in buffer.c */
 bool append_lines( const char ** const ibufpp, const int addr,
                    bool insert, const bool isglobal );
+long buffer_changes( void );
+void check_encoding( const char * const s, const long size );
+void clear_yank_buffer( void );
 bool close_sbuf( void );
+void compact_sbuf( void );
 bool copy_lines( const int first_addr, const int second_addr, const int addr );
+bool copy_sources( const char * const filename );
 int current_addr( void );
 int dec_addr( int addr );
 bool delete_lines( const int from, const int to, const bool isglobal );
+void discard_lazy_lines( void );
 int get_line_node_addr( const line_t * const lp );
 char * get_sbuf_line( const line_t * const lp );
+const char * get_sbuf_mapped( const line_t * const lp, int * const fdp,
+                              long * const offp );
+const char * get_sbuf_text( const line_t * const lp );
 int inc_addr( int addr );
 int inc_current_addr( void );
 bool init_buffers( void );
 bool isbinary( void );
 bool join_lines( const int from, const int to, const bool isglobal );
 int last_addr( void );
+int last_addr_upto( const int addr );
+int leased_source( const struct stat * const st );
+int map_source( const char * const filename, const char ** const textp,
+                long * const sizep );
 bool modified( void );
 bool move_lines( const int first_addr, const int second_addr, const int addr,
                  const bool isglobal );
+bool nonascii( void );
 bool open_sbuf( void );
 int path_max( const char * filename );
+void print_sbuf_stats( void );
 bool put_lines( const int addr );
 const char * put_sbuf_line( const char * const buf, const int size );
+bool put_sbuf_lines( const char * const buf, const long size );
+bool put_source_line( const int src, const long pos, const int len );
+void read_lazily( const int src );
+bool renew_source_lease( const int src, const int fd );
+long sbuf_map_moves( void );
+bool sbuf_mapped( void );
 line_t * search_line_node( const int addr );
 void set_binary( void );
 void set_current_addr( const int addr );
 void set_modified( const bool m );
+long source_prefix( const int src, int from, const int to, int * const addrp );
+void sync_stdin( void );
+int unlease_source( const int src, const long pos );
+void yank_last_deleted_line( void );
 bool yank_lines( const int from, const int to );
 void clear_undo_stack( void );
+bool multilevel_undo( void );
 undo_t * push_undo_atom( const int type, const int from, const int to );
+bool redo( const bool isglobal );
 void reset_undo_state( void );
+void set_undo_levels( const int n );
+void set_undo_memory( const long bytes );
 bool undo( const bool isglobal );
 
 /* defined in global.c */
 void clear_active_list( void );
 const line_t * next_active_node( void );
-bool set_active_node( const line_t * const lp );
-void unset_active_nodes( const line_t * bp, const line_t * const ep );
+bool set_active_node( line_t * const lp );
+void unset_active_nodes( line_t * bp, const line_t * const ep );
+
+/* defined in index.c */
+int index_addr( const line_t * lp );
+bool index_contains( const line_t * const lp );
+void index_insert( line_t * const first, const int n, const int addr );
+line_t * index_node( int addr );
+void index_reinsert( const line_t * const lp, const int addr );
+void index_remove( const int from, const int to );
 
 /* defined in io.c */
+bool filter_lines( const char * const command, const int from, const int to,
+                   const bool isglobal );
 bool get_extended_line( const char ** const ibufpp, int * const lenp,
                         const bool strip_escaped_newlines );
 const char * get_stdin_line( int * const sizep );
 int linenum( void );
 bool print_lines( int from, const int to, const int pflags );
-int read_file( const char * const filename, const int addr );
+int read_file( const char * const filename, const int addr,
+               const bool lazy_ok = false );
+int reload_file( const char * const filename );
 int write_file( const char * const filename, const char * const mode,
                 const int from, const int to );
 void reset_unterminated_line( void );
-void unmark_unterminated_line( const line_t * const lp );
+void unmark_deleted_unterminated_line( void );
+
+/* defined in journal.c */
+void checkpoint_journal( const char * const filename );
+void close_journal( void );
+bool flush_journal( void );
+bool journal_active( void );
+bool journal_base_intact( void );
+void journal_copy( const int from, const int to, const int addr );
+void journal_delete( const int from, const int to );
+void journal_line( const int addr, const char * const text, const int len );
+void journal_move( const int from, const int to, const int addr );
+void journal_text( const int addr, const char * const text, const long size );
+bool open_journal( const char * const name, const char * const filename,
+                   const bool append );
+void pause_journal( void );
+const char * recover_journal( const char * const name );
 
 /* defined in main.c */
 bool extended_regexp( bool set = false, bool new_val = false );
+bool fsync_output( bool set = false, bool new_val = false );
+bool incremental_write( bool set = false, bool new_val = false );
 bool is_regular_file( const int fd );
+bool lazy_index( bool set = false, bool new_val = false );
+bool map_input( bool set = false, bool new_val = false );
 bool may_access_filename( const char * const name );
 bool restricted( bool set = false, bool new_val = false );
+bool safe_save( bool set = false, bool new_val = false );
 bool scripted( bool set = false, bool new_val = false );
 void show_strerror( const char * const filename, const int errcode );
+bool stats( bool set = false, bool new_val = false );
+bool stdio_scratch( bool set = false, bool new_val = false );
 bool strip_cr( bool set = false, bool new_val = false );
+bool tail_reload( bool set = false, bool new_val = false );
 bool traditional( bool set = false, bool new_val = false );
 
 /* defined in main_loop.c */
 void invalid_address( void );
 int main_loop( const bool initial_error, const bool loose );
+void print_command_stats( const bool histogram );
 bool set_def_filename( const char * const s );
 void set_error_msg( const char * const msg );
 bool set_prompt( const char * const s );
 void set_verbose( void );
-void unmark_line_node( const line_t * const lp );
+void unmark_deleted_nodes( void );
 
 /* defined in regex.c */
 bool build_active_list( const char ** const ibufpp, const int first_addr,
@@ -135,15 +222,23 @@ bool build_active_list( const char ** const ibufpp, const int first_addr,
 const char * get_pattern_for_s( const char ** const ibufpp );
 bool extract_replacement( const char ** const ibufpp, const bool isglobal );
 int next_matching_node_addr( const char ** const ibufpp );
+void print_regex_stats( void );
 bool search_and_replace( const int first_addr, const int second_addr,
-                         const int snum, const bool isglobal );
+                         const int snum, const bool isglobal,
+                         int * const error_addrp = 0 );
+void set_match_threads( const int n );
+void set_regex_cache_size( const int size );
+void set_regex_matcher( const enum Matcher m );
 bool set_subst_regex( const char * const pat, const bool ignore_case );
 bool replace_subst_re_by_search_re( void );
 bool subst_regex( void );
 
 /* defined in signal.c */
+void catch_sigio( void );
 void disable_interrupts( void );
 void enable_interrupts( void );
+void forward_interrupts( const int pid );
+long long monotonic_ns( void );
 bool resize_buffer( char ** const buf, int * const size, const unsigned min_size );
 void set_signals( void );
 void set_window_lines( const int lines );
@@ -26,20 +26,25 @@
 #include "ed.h"
 
 
-static const line_t **active_list = 0;	/* list of lines active in a global command */
-static int active_size = 0;	/* size (in bytes) of active_list */
+/* Lines in active_list have the flag lf_active set. Lines removed from the
+   list by unset_active_nodes just have the flag reset, and are skipped by
+   next_active_node. This makes the removal O(1) per line.
+   The list must be cleared while its nodes are still allocated. */
+static line_t **active_list = 0;	/* list of lines active in a global command */
+static long active_size = 0;	/* size (in bytes) of active_list */
 static int active_len = 0;	/* number of lines in active_list */
 static int active_idx = 0;	/* active_list index ( non-decreasing ) */
-static int active_idxm = 0;	/* active_list index ( modulo active_len ) */
 
 
 /* clear the global-active list */
 void clear_active_list( void )
   {
   disable_interrupts();
+  while( active_idx < active_len )
+    active_list[active_idx++]->flags &= ~lf_active;
   if( active_list ) free( active_list );
   active_list = 0;
-  active_size = active_len = active_idx = active_idxm = 0;
+  active_size = active_len = active_idx = 0;
   enable_interrupts();
   }
 
@@ -47,22 +52,25 @@ void clear_active_list( void )
 /* return the next global-active line node */
 const line_t * next_active_node( void )
   {
-  while( active_idx < active_len && !active_list[active_idx] )
+  while( active_idx < active_len &&
+         !( active_list[active_idx]->flags & lf_active ) )
     ++active_idx;
-  return ( active_idx < active_len ) ? active_list[active_idx++] : 0;
+  if( active_idx >= active_len ) return 0;
+  line_t * const lp = active_list[active_idx++];
+  lp->flags &= ~lf_active;
+  return lp;
   }
 
 
 /* add a line node to the global-active list */
-bool set_active_node( const line_t * const lp )
+bool set_active_node( line_t * const lp )
   {
-  const unsigned min_size = ( active_len + 1 ) * sizeof (line_t **);
-  if( (unsigned)active_size < min_size )
+  const long min_size = ( active_len + 1L ) * sizeof (line_t **);
+  if( active_size < min_size )
     {
-    if( min_size >= INT_MAX )
+    if( active_len >= INT_MAX - 1 )
       { set_error_msg( "Too many matching lines" ); return false; }
-    const int new_size = ( ( min_size < 512 ) ? 512 :
-      ( min_size > INT_MAX / 2 ) ? INT_MAX : ( min_size / 512 ) * 1024 );
+    const long new_size = ( min_size < 512 ) ? 512 : ( min_size / 512 ) * 1024;
     void * new_buf = 0;
     disable_interrupts();
     if( active_list ) new_buf = realloc( active_list, new_size );
@@ -71,26 +79,17 @@ bool set_active_node( const line_t * const lp )
       { show_strerror( 0, errno );
         set_error_msg( mem_msg ); enable_interrupts(); return false; }
     active_size = new_size;
-    active_list = (const line_t **)new_buf;
+    active_list = (line_t **)new_buf;
     enable_interrupts();
     }
   active_list[active_len++] = lp;
+  lp->flags |= lf_active;
   return true;
   }
 
 
 /* remove a range of lines from the global-active list */
-void unset_active_nodes( const line_t * bp, const line_t * const ep )
+void unset_active_nodes( line_t * bp, const line_t * const ep )
   {
-  while( bp != ep )
-    {
-    int i;
-    for( i = 0; i < active_len; ++i )
-      {
-      if( ++active_idxm >= active_len ) active_idxm = 0;
-      if( active_list[active_idxm] == bp )
-        { active_list[active_idxm] = 0; break; }
-      }
-    bp = bp->q_forw;
-    }
+  for( ; bp != ep; bp = bp->q_forw ) bp->flags &= ~lf_active;
   }
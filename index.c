@@ -0,0 +1,233 @@
+/* index.c: line index routines for the ed line editor. */
+/* GNU ed - The GNU line editor.
+   Copyright (C) 2006-2022 Antonio Diaz Diaz.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/*
+   The lines of the editor buffer are kept in an implicit treap (a
+   randomized binary search tree ordered by position) in addition to the
+   circular linked list. Each node stores the size of its subtree, so
+   that both address-to-node and node-to-address run in O(log n).
+   Priorities are derived from the address of the node, so no storage is
+   spent on them.
+
+   Consecutive insertions (like those made while reading a file or
+   appending text) are collected in a pending run that is linked in the
+   list but not yet in the tree. The run is built into a subtree in linear
+   time and merged into the tree the next time the index is queried.
+*/
+
+#include <stdint.h>
+
+#include "ed.h"
+
+
+static line_t * root = 0;		/* root of the index of the buffer */
+static line_t * pend_first = 0;		/* pending run of inserted nodes */
+static int pend_addr = 0;		/* address after which run goes */
+static int pend_len = 0;		/* number of nodes in pending run */
+
+
+static unsigned long priority( const line_t * const lp )
+  {
+  unsigned long long x = (uintptr_t)lp;		/* murmur3 finalizer */
+  x ^= x >> 33; x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33; x *= 0xc4ceb9fe1a85ec53ULL;
+  x ^= x >> 33;
+  return x;
+  }
+
+static int tsize( const line_t * const lp ) { return lp ? lp->t_size : 0; }
+
+static void update( line_t * const lp )
+  { lp->t_size = 1 + tsize( lp->t_left ) + tsize( lp->t_right ); }
+
+static void set_left( line_t * const lp, line_t * const child )
+  { lp->t_left = child; if( child ) child->t_parent = lp; }
+
+static void set_right( line_t * const lp, line_t * const child )
+  { lp->t_right = child; if( child ) child->t_parent = lp; }
+
+
+/* join two trees; all the nodes of 'a' go before those of 'b' */
+static line_t * merge( line_t * const a, line_t * const b )
+  {
+  if( !a ) return b;
+  if( !b ) return a;
+  if( priority( a ) > priority( b ) )
+    { set_right( a, merge( a->t_right, b ) ); update( a ); return a; }
+  set_left( b, merge( a, b->t_left ) ); update( b ); return b;
+  }
+
+
+/* split tree 't' in the first 'k' nodes (*lp) and the rest (*rp) */
+static void split( line_t * const t, const int k,
+                   line_t ** const lp, line_t ** const rp )
+  {
+  if( !t ) { *lp = *rp = 0; return; }
+  const int lsize = tsize( t->t_left );
+  if( lsize < k )
+    {
+    line_t * r;
+    split( t->t_right, k - lsize - 1, &r, rp );
+    set_right( t, r ); *lp = t;
+    }
+  else
+    {
+    line_t * l;
+    split( t->t_left, k, lp, &l );
+    set_left( t, l ); *rp = t;
+    }
+  update( t );
+  t->t_parent = 0;
+  }
+
+
+/* compute subtree sizes of a newly built tree in post-order */
+static void fix_sizes( line_t * lp )
+  {
+  const line_t * prev = 0;
+
+  while( lp )
+    {
+    if( prev == lp->t_parent && lp->t_left ) { prev = lp; lp = lp->t_left; }
+    else if( prev != lp->t_right && lp->t_right )
+      { prev = lp; lp = lp->t_right; }
+    else { update( lp ); prev = lp; lp = lp->t_parent; }
+    }
+  }
+
+
+/* Build a tree from a list of 'n' linked nodes in linear time.
+   The nodes are pushed on the right spine of the tree built so far,
+   keeping the heap order of priorities (Cartesian tree). */
+static line_t * build_tree( line_t * lp, int n )
+  {
+  line_t * top = 0;			/* last node of the right spine */
+
+  for( ; n > 0; --n, lp = lp->q_forw )
+    {
+    const unsigned long prio = priority( lp );
+    line_t * last = 0;
+    while( top && priority( top ) < prio ) { last = top; top = top->t_parent; }
+    lp->t_right = 0;
+    lp->t_left = last; if( last ) last->t_parent = lp;
+    lp->t_parent = top; if( top ) top->t_right = lp;
+    top = lp;
+    }
+  while( top && top->t_parent ) top = top->t_parent;
+  fix_sizes( top );
+  return top;
+  }
+
+
+/* insert a tree of nodes after the given address */
+static void insert_tree( line_t * const t, const int addr )
+  {
+  line_t *l, *r;
+  split( root, addr, &l, &r );
+  root = merge( merge( l, t ), r );
+  root->t_parent = 0;
+  }
+
+
+static void flush_pending( void )
+  {
+  if( !pend_len ) return;
+  line_t * const t = build_tree( pend_first, pend_len );
+  pend_len = 0; pend_first = 0;
+  insert_tree( t, pend_addr );
+  }
+
+
+/* return the root of the tree containing lp */
+static const line_t * root_of( const line_t * lp )
+  {
+  while( lp->t_parent ) lp = lp->t_parent;
+  return lp;
+  }
+
+
+/* return true if lp is a line of the editor buffer */
+bool index_contains( const line_t * const lp )
+  {
+  flush_pending();
+  return ( lp && root && root_of( lp ) == root );
+  }
+
+
+/* return the address of a line of the editor buffer */
+int index_addr( const line_t * lp )
+  {
+  flush_pending();
+  int addr = tsize( lp->t_left ) + 1;
+  for( ; lp->t_parent; lp = lp->t_parent )
+    if( lp == lp->t_parent->t_right )
+      addr += tsize( lp->t_parent->t_left ) + 1;
+  return addr;
+  }
+
+
+/* return the node at the given address ( 1 <= addr <= size ) */
+line_t * index_node( int addr )
+  {
+  flush_pending();
+  line_t * lp = root;
+  while( lp )
+    {
+    const int lsize = tsize( lp->t_left );
+    if( addr <= lsize ) lp = lp->t_left;
+    else if( addr == lsize + 1 ) break;
+    else { addr -= lsize + 1; lp = lp->t_right; }
+    }
+  return lp;
+  }
+
+
+/* Index 'n' nodes, starting at 'first', as lines following 'addr'.
+   To be called before linking the nodes in the list, because it may need
+   to walk the current pending run. Insertions extending the pending run
+   are O(1).
+   All the index functions must be called before modifying the list. */
+void index_insert( line_t * const first, const int n, const int addr )
+  {
+  if( n <= 0 ) return;
+  if( pend_len && addr == pend_addr + pend_len )
+    { pend_len += n; return; }
+  flush_pending();
+  pend_first = first; pend_addr = addr; pend_len = n;
+  }
+
+
+/* reinsert a tree previously detached by index_remove after 'addr' */
+void index_reinsert( const line_t * const lp, const int addr )
+  {
+  flush_pending();
+  insert_tree( (line_t *)root_of( lp ), addr );
+  }
+
+
+/* Detach lines 'from' to 'to' from the index. The detached nodes keep
+   their tree, so they can be reinserted in O(log n) by index_reinsert. */
+void index_remove( const int from, const int to )
+  {
+  line_t *l, *m, *r;
+
+  flush_pending();
+  split( root, to, &m, &r );
+  split( m, from - 1, &l, &m );
+  root = merge( l, r );
+  if( root ) root->t_parent = 0;
+  }
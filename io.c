@@ -18,8 +18,18 @@
 */
 
 #include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <poll.h>
+#include <signal.h>
+#include <spawn.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <sys/wait.h>
 
 #include "ed.h"
 
@@ -31,49 +41,79 @@ int linenum( void ) { return linenum_; }
 
 void reset_unterminated_line( void ) { unterminated_line = 0; }
 
-void unmark_unterminated_line( const line_t * const lp )
-  { if( unterminated_line == lp ) unterminated_line = 0; }
+void unmark_deleted_unterminated_line( void )
+  { if( unterminated_line && !index_contains( unterminated_line ) )
+      unterminated_line = 0; }
 
 static bool unterminated_last_line( void )
   { return ( unterminated_line != 0 &&
              unterminated_line == search_line_node( last_addr() ) ); }
 
 
-/* print text to stdout */
-static void print_line( const char * p, int len, const int pflags )
+/* representation of each char in 'l' mode; the length is in rep[0] */
+static const char ( * list_table( void ) )[5]
   {
+  static char table[256][5];
+  static bool ready = false;
   const char escapes[] = "\a\b\f\n\r\t\v";
   const char escchars[] = "abfnrtv";
-  int col = 0;
 
-  if( pflags & pf_n ) { printf( "%d\t", current_addr() ); col = 8; }
-  while( --len >= 0 )
+  if( ready ) return table;
+  for( int ch = 0; ch < 256; ++ch )
     {
-    const unsigned char ch = *p++;
-    if( !( pflags & pf_l ) ) putchar( ch );
+    char * const rep = table[ch];
+    const char * const p = strchr( escapes, ch );
+    if( ch >= 32 && ch <= 126 && ch != '$' && ch != '\\' )
+      { rep[0] = 1; rep[1] = ch; }
+    else if( ch == '$' || ch == '\\' )
+      { rep[0] = 2; rep[1] = '\\'; rep[2] = ch; }
+    else if( ch && p )
+      { rep[0] = 2; rep[1] = '\\'; rep[2] = escchars[p-escapes]; }
     else
       {
-      if( ++col > window_columns() ) { col = 1; fputs( "\\\n", stdout ); }
-      if( ch >= 32 && ch <= 126 )
-        { if( ch == '$' || ch == '\\' ) { ++col; putchar('\\'); }
-          putchar( ch ); }
-      else
-        {
-        const char * p = strchr( escapes, ch );
-        ++col; putchar('\\');
-        if( ch && p ) putchar( escchars[p-escapes] );
-        else
-          {
-          col += 2;
-          putchar( ( ( ch >> 6 ) & 7 ) + '0' );
-          putchar( ( ( ch >> 3 ) & 7 ) + '0' );
-          putchar( ( ch & 7 ) + '0' );
-          }
-        }
+      rep[0] = 4; rep[1] = '\\';
+      rep[2] = ( ( ch >> 6 ) & 7 ) + '0';
+      rep[3] = ( ( ch >> 3 ) & 7 ) + '0';
+      rep[4] = ( ch & 7 ) + '0';
       }
     }
-  if( !traditional() && ( pflags & pf_l ) ) putchar('$');
-  putchar('\n');
+  ready = true;
+  return table;
+  }
+
+
+/* Print text to stdout. 'p' must be followed by a newline, as returned
+   by get_sbuf_text. In 'l' mode the text is rendered in blocks. */
+static void print_line( const char * p, int len, const int pflags )
+  {
+  char buf[4096];
+  int i = 0;				/* bytes in buf */
+  int col = 0;
+
+  if( pflags & pf_n )			/* same as printf( "%d\t" ) */
+    {
+    char num[16];
+    int n = 0;
+    for( unsigned addr = current_addr(); ; addr /= 10 )
+      { num[n++] = '0' + addr % 10; if( addr < 10 ) break; }
+    while( n > 0 ) buf[i++] = num[--n];
+    buf[i++] = '\t'; col = 8;
+    }
+  if( !( pflags & pf_l ) )
+    { fwrite( buf, 1, i, stdout ); fwrite( p, 1, len + 1, stdout ); return; }
+  const char ( * const table )[5] = list_table();
+  const int columns = window_columns();
+  while( --len >= 0 )
+    {
+    const char * const rep = table[(unsigned char)*p++];
+    if( i > (int)sizeof buf - 8 ) { fwrite( buf, 1, i, stdout ); i = 0; }
+    if( col >= columns ) { col = 0; buf[i++] = '\\'; buf[i++] = '\n'; }
+    col += rep[0];
+    for( int j = 1; j <= rep[0]; ++j ) buf[i++] = rep[j];
+    }
+  if( !traditional() ) buf[i++] = '$';
+  buf[i++] = '\n';
+  fwrite( buf, 1, i, stdout );
   }
 
 
@@ -86,10 +126,11 @@ bool print_lines( int from, const int to, const int pflags )
   if( !from ) { invalid_address(); return false; }
   while( bp != ep )
     {
-    const char * const s = get_sbuf_line( bp );
+    disable_interrupts();
+    const char * const s = get_sbuf_text( bp );
+    if( s ) { set_current_addr( from++ ); print_line( s, bp->len, pflags ); }
+    enable_interrupts();
     if( !s ) return false;
-    set_current_addr( from++ );
-    print_line( s, bp->len, pflags );
     bp = bp->q_forw;
     }
   return true;
@@ -156,8 +197,9 @@ const char * get_stdin_line( int * const sizep )
 
   while( true )
     {
-    const int c = getchar();
-    if( !resize_buffer( &buf, &bufsz, i + 2 ) ) { *sizep = 0; return 0; }
+    const int c = getchar_unlocked();
+    if( i + 2 > bufsz && !resize_buffer( &buf, &bufsz, i + 2 ) )
+      { *sizep = 0; return 0; }
     if( c == EOF )
       {
       if( ferror( stdin ) )
@@ -185,78 +227,158 @@ const char * get_stdin_line( int * const sizep )
   }
 
 
-/* Read a line of text from a stream.
-   Return pointer to buffer and line size (including trailing newline
-   if it exists and is not added now).
+/* Remove the CR from the CR/LF pairs ending the lines of a block of
+   complete lines. Return the new size of the block. */
+static int strip_crs( char * const buf, const int size )
+  {
+  int i = 0, j = 0;			/* read and write positions */
+
+  while( i < size )
+    {
+    const char * const p = (const char *) memchr( buf + i, '\n', size - i );
+    int n = p + 1 - ( buf + i );
+    const bool cr = ( n > 1 && p[-1] == '\r' );
+    if( cr ) --n;
+    if( j != i ) memmove( buf + j, buf + i, n );
+    if( cr ) buf[j+n-1] = '\n';
+    i += n + cr; j += n;
+    }
+  return j;
+  }
+
+
+/* Read a block of complete lines from a stream with large reads.
+   '*endp' bytes, starting at '*posp', are pending in the read buffer.
+   Return pointer to the block and its size, or, at end of stream, to
+   the last line and its size (including trailing newline if it exists
+   and is not added now). Return 0 if error, or *sizep = 0 if EOF.
 */
-static const char * read_stream_line( const char * const filename,
-                                      FILE * const fp, int * const sizep,
-                                      bool * const newline_addedp )
+static const char * read_stream_block( const char * const filename,
+                                       const int fd, int * const endp,
+                                       int * const posp, long * const sizep,
+                                       bool * const newline_addedp )
   {
+  enum { block_size = 1 << 16 };
   static char * buf = 0;
   static int bufsz = 0;
-  int c, i = 0;
+  int scanned;				/* bytes known to have no newline */
 
-  while( true )
+  if( *posp > 0 )			/* discard the lines returned */
     {
-    if( !resize_buffer( &buf, &bufsz, i + 2 ) ) return 0;
-    c = getc( fp ); if( c == EOF ) break;
-    buf[i++] = c;
-    if( !c ) set_binary();
-    else if( c == '\n' )		/* remove CR only from CR/LF pairs */
-      { if( strip_cr() && i > 1 && buf[i-2] == '\r' ) { buf[i-2] = '\n'; --i; }
-        break; }
+    *endp -= *posp;
+    memmove( buf, buf + *posp, *endp );
+    *posp = 0;
     }
-  buf[i] = 0;
-  if( c == EOF )
+  for( scanned = 0; ; )
     {
-    if( ferror( fp ) )
+    const char * const p = (const char *)
+      memrchr( buf + scanned, '\n', *endp - scanned );
+    if( p )
       {
+      const int i = p + 1 - buf;
+      *posp = i;
+      *sizep = strip_cr() ? strip_crs( buf, i ) : i;
+      return buf;
+      }
+    scanned = *endp;
+    if( !resize_buffer( &buf, &bufsz, *endp + block_size + 2 ) ) return 0;
+    const long n = read( fd, buf + *endp, block_size );
+    if( n < 0 )
+      {
+      if( errno == EINTR ) continue;
       show_strerror( filename, errno );
       set_error_msg( "Cannot read input file" );
       return 0;
       }
-    else if( i )
-      {
-      buf[i] = '\n'; buf[i+1] = 0; *newline_addedp = true;
-      if( !isbinary() ) ++i;
-      }
+    if( n == 0 ) break;				/* EOF */
+    if( memchr( buf + *endp, 0, n ) ) set_binary();
+    *endp += n;
+    }
+  int i = *endp;
+  *endp = 0;
+  if( i )
+    {
+    buf[i] = '\n'; buf[i+1] = 0; *newline_addedp = true;
+    if( !isbinary() ) ++i;
     }
   *sizep = i;
   return buf;
   }
 
 
-/* read a stream into the editor buffer;
-   return total size of data read, or -1 if error */
+/* Read a line of text from an input file mapped in memory.
+   Return pointer to the text and line size like read_stream_block.
+   Set *in_placep if the text returned is in the mapping.
+*/
+static const char * read_mapped_line( const char * const text,
+                                      const long text_size, long * const posp,
+                                      long * const sizep,
+                                      bool * const newline_addedp,
+                                      bool * const in_placep )
+  {
+  static char * buf = 0;
+  static int bufsz = 0;
+  const char * const s = text + *posp;
+  const long rest = text_size - *posp;
+  const char * const p = (const char *) memchr( s, '\n', rest );
+  long i = p ? p + 1 - s : rest;
+
+  *in_placep = false;
+  if( i >= INT_MAX ) { set_error_msg( "Line too long" ); return 0; }
+  *posp += i;
+  if( p && !( strip_cr() && i > 1 && s[i-2] == '\r' ) )
+    { *in_placep = true; *sizep = i; return s; }
+  if( !resize_buffer( &buf, &bufsz, i + 2 ) ) return 0;
+  memcpy( buf, s, i );
+  if( p ) { buf[i-2] = '\n'; buf[--i] = 0; }	/* remove CR from CR/LF */
+  else
+    { buf[i] = '\n'; buf[i+1] = 0; *newline_addedp = true;
+      if( !isbinary() ) ++i; }
+  *sizep = i;
+  return buf;
+  }
+
+
+/* Read a stream, or the text of source 'src' if src >= 0, into the
+   editor buffer. Complete lines of a source are not copied.
+   Return total size of data read, or -1 if error. */
 static long read_stream( const char * const filename, FILE * const fp,
-                         const int addr )
+                         const int src, const char * const text,
+                         const long text_size, const int addr,
+                         bool * const newline_addedp )
   {
-  line_t * lp = search_line_node( addr );
   undo_t * up = 0;
   long total_size = 0;
   const bool o_isbinary = isbinary();
-  const bool appended = ( addr == last_addr() );
+  const bool appended = ( addr == last_addr_upto( addr ) );
   const bool o_unterminated_last_line = unterminated_last_line();
   bool newline_added = false;
+  long pos = 0;				/* position in text */
+  int end = 0, start = 0;		/* state of read_stream_block */
 
+  if( src >= 0 && memchr( text, 0, text_size ) ) set_binary();
+  if( src >= 0 ) check_encoding( text, text_size );
   set_current_addr( addr );
   while( true )
     {
-    int size = 0;
-    const char * const s =
-      read_stream_line( filename, fp, &size, &newline_added );
+    long size = 0;
+    bool in_place = false;
+    const char * const s = ( src < 0 ) ?
+      read_stream_block( filename, fileno( fp ), &end, &start, &size,
+                         &newline_added ) :
+      ( pos < text_size ) ? read_mapped_line( text, text_size, &pos, &size,
+                                &newline_added, &in_place ) : text;
     if( !s ) return -1;
     if( size <= 0 ) break;
     total_size += size;
     disable_interrupts();
-    if( !put_sbuf_line( s, size + newline_added ) )
+    if( in_place ? !put_source_line( src, s - text, size - 1 ) :
+                   !put_sbuf_lines( s, size + newline_added ) )
       { enable_interrupts(); return -1; }
-    lp = lp->q_forw;
-    if( up ) up->tail = lp;
+    if( up ) up->tail = search_line_node( current_addr() );
     else
       {
-      up = push_undo_atom( UADD, current_addr(), current_addr() );
+      up = push_undo_atom( UADD, addr + 1, current_addr() );
       if( !up ) { enable_interrupts(); return -1; }
       }
     enable_interrupts();
@@ -269,34 +391,135 @@ static long read_stream( const char * const filename, FILE * const fp,
     ++total_size;
   if( appended && isbinary() && ( newline_added || total_size == 0 ) )
     unterminated_line = search_line_node( last_addr() );
+  *newline_addedp = newline_added;
   return total_size;
   }
 
 
-/* Read a named file/pipe into the buffer.
-   Return line count, -1 if file not found, -2 if fatal error.
+/* The file last read in full by read_file, so that 'e' can read only
+   the lines appended to it since ( --tail-reload ). */
+typedef struct
+  {
+  char * name;			/* name given to read_file, or 0 if none */
+  dev_t dev;
+  ino_t ino;
+  long size;			/* bytes read */
+  unsigned long long sum;	/* checksum of the last bytes read */
+  long changes;			/* buffer_changes() after the read */
+  }
+tail_t;
+
+static tail_t tail = { 0, 0, 0, 0, 0, 0 };
+
+enum { tail_sum_size = 4096 };
+
+static void forget_tail( void ) { free( tail.name ); tail.name = 0; }
+
+
+/* return the FNV-1a hash of 'n' bytes at 'p' */
+static unsigned long long tail_sum( const char * const p, const int n )
+  {
+  unsigned long long h = 14695981039346656037ULL;
+  for( int i = 0; i < n; ++i )
+    { h ^= (unsigned char)p[i]; h *= 1099511628211ULL; }
+  return h;
+  }
+
+
+/* Store in *sump the checksum of the bytes before offset 'size' of the
+   file open as 'fd'. Return false if error. */
+static bool file_tail_sum( const int fd, const long size,
+                           unsigned long long * const sump )
+  {
+  char buf[tail_sum_size];
+  const int n = min( size, (long)tail_sum_size );
+  int i = 0;
+
+  while( i < n )
+    {
+    const long r = pread( fd, buf + i, n - i, size - n + i );
+    if( r < 0 && errno == EINTR ) continue;
+    if( r <= 0 ) return false;
+    i += r;
+    }
+  *sump = tail_sum( buf, n );
+  return true;
+  }
+
+
+/* Remember 'filename' as the file held by the buffer, if it is a regular
+   file read exactly. Its first 'size' bytes are at 'text' if it is mapped,
+   else it is open as 'fd'. */
+static void remember_tail( const char * const filename, const int fd,
+                           const char * const text, const long size )
+  {
+  struct stat st;
+
+  if( !tail_reload() || *filename == '!' || strip_cr() || isbinary() ) return;
+  if( fd >= 0 ) { if( fstat( fd, &st ) != 0 ) return; }
+  else
+    { const char * const stripped_name = strip_escapes( filename );
+      if( !stripped_name || stat( stripped_name, &st ) != 0 ) return; }
+  if( !S_ISREG( st.st_mode ) ) return;
+  if( text )
+    { const int n = min( size, (long)tail_sum_size );
+      tail.sum = tail_sum( text + size - n, n ); }
+  else if( !file_tail_sum( fd, size, &tail.sum ) ) return;
+  tail.name = (char *)malloc( strlen( filename ) + 1 );
+  if( !tail.name ) return;
+  strcpy( tail.name, filename );
+  tail.dev = st.st_dev; tail.ino = st.st_ino; tail.size = size;
+  tail.changes = buffer_changes();
+  }
+
+
+/* Read a named file/pipe into the buffer. If 'lazy_ok' and lazy_index,
+   the buffer is empty and a regular file ending in newline is indexed
+   lazily.
+   Return line count ( 0 if read lazily ), -1 if file not found, -2 if
+   fatal error.
 */
-int read_file( const char * const filename, const int addr )
+int read_file( const char * const filename, const int addr,
+               const bool lazy_ok )
   {
-  FILE * fp;
+  FILE * fp = 0;
+  const char * text = 0;
+  long text_size = 0;
+  int src = -1;				/* source of the text, if mapped */
+  const bool lazy = lazy_ok && lazy_index();
+  bool newline_added = false;
   long size;
   int ret;
 
-  if( *filename == '!' ) fp = popen( filename + 1, "r" );
+  if( lazy_ok ) forget_tail();
+  if( *filename == '!' ) { sync_stdin(); fp = popen( filename + 1, "r" ); }
   else
     {
     const char * const stripped_name = strip_escapes( filename );
     if( !stripped_name ) return -2;
-    fp = fopen( stripped_name, "r" );
+    if( map_input() || lazy )
+      src = map_source( stripped_name, &text, &text_size );
+    if( src < 0 ) fp = fopen( stripped_name, "r" );
     }
-  if( !fp )
+  if( !fp && src < 0 )
     {
     show_strerror( filename, errno );
     set_error_msg( "Cannot open input file" );
     return -1;
     }
-  size = read_stream( filename, fp, addr );
-  if( *filename == '!' ) ret = pclose( fp ); else ret = fclose( fp );
+  if( lazy && src >= 0 && !strip_cr() && text[text_size-1] == '\n' )
+    {
+    read_lazily( src );
+    remember_tail( filename, -1, text, text_size );
+    if( !scripted() ) printf( "%lu\n", text_size );
+    return 0;
+    }
+  size = read_stream( filename, fp, src, text, text_size, addr,
+                      &newline_added );
+  if( lazy_ok && size >= 0 && !newline_added )
+    remember_tail( filename, fp ? fileno( fp ) : -1, text, size );
+  if( src >= 0 ) ret = 0;
+  else if( *filename == '!' ) ret = pclose( fp ); else ret = fclose( fp );
   if( size < 0 ) return -2;
   if( ret != 0 )
     {
@@ -309,49 +532,297 @@ int read_file( const char * const filename, const int addr )
   }
 
 
-/* write a range of lines to a stream */
+/* If the buffer holds the text of the file last read in full as
+   'filename', unchanged, and the file has only grown since, append the
+   lines added to the file. The file is the same if its device, inode and
+   last bytes read are the same.
+   Return 1 if done, 0 if the file must be read in full, -2 if fatal
+   error.
+*/
+int reload_file( const char * const filename )
+  {
+  struct stat st;
+  unsigned long long sum;
+  bool newline_added = false;
+
+  if( !tail.name || strcmp( filename, tail.name ) != 0 ||
+      buffer_changes() != tail.changes ) return 0;
+  const char * const stripped_name = strip_escapes( filename );
+  if( !stripped_name ) return -2;
+  const int fd = open( stripped_name, O_RDONLY | O_CLOEXEC );
+  if( fd < 0 ) return 0;
+  FILE * const fp = ( fstat( fd, &st ) == 0 && S_ISREG( st.st_mode ) &&
+    st.st_dev == tail.dev && st.st_ino == tail.ino &&
+    st.st_size >= tail.size && file_tail_sum( fd, tail.size, &sum ) &&
+    sum == tail.sum && lseek( fd, tail.size, SEEK_SET ) == tail.size ) ?
+    fdopen( fd, "r" ) : 0;
+  if( !fp ) { close( fd ); return 0; }
+  const long size = read_stream( filename, fp, -1, 0, 0, last_addr(),
+                                 &newline_added );
+  if( size < 0 ) { fclose( fp ); forget_tail(); return -2; }
+  const long total_size = tail.size += size;
+  if( newline_added || isbinary() ||
+      !file_tail_sum( fd, tail.size, &tail.sum ) ) forget_tail();
+  else tail.changes = buffer_changes();
+  if( fclose( fp ) != 0 )
+    {
+    show_strerror( filename, errno );
+    set_error_msg( "Cannot close input file" );
+    forget_tail();
+    return -2;
+    }
+  if( !scripted() ) printf( "%lu\n", total_size );
+  return 1;
+  }
+
+
+typedef struct			/* state of write_stream */
+  {
+  FILE * fp;
+  int fd;			/* file descriptor of fp */
+  bool stdio;			/* if set, fp may contain pending data */
+  bool copy_ok;			/* if set, try copy_file_range on fd */
+  int n;			/* number of pending slices */
+  struct iovec iov[1024];
+  }
+wstate_t;
+
+
+/* write the pending slices; return false if error */
+static bool flush_slices( wstate_t * const wp )
+  {
+  struct iovec * iov = wp->iov;
+
+  while( wp->n > 0 )
+    {
+    long w = writev( wp->fd, iov, wp->n );
+    if( w < 0 ) { if( errno == EINTR ) continue; wp->n = 0; return false; }
+    while( wp->n > 0 && (unsigned long)w >= iov->iov_len )
+      { w -= iov->iov_len; ++iov; --wp->n; }
+    if( wp->n > 0 )
+      { iov->iov_base = (char *)iov->iov_base + w; iov->iov_len -= w; }
+    }
+  return true;
+  }
+
+
+/* Write 'len' bytes of text at 'p', which can also be read from file
+   descriptor 'fd' ( if fd >= 0 ) at offset 'off'. Large runs are copied
+   by the kernel from file to file. Return false if error. */
+static bool write_run( wstate_t * const wp, const char * p, long len,
+                       const int fd, long off )
+  {
+  enum { copy_min = 1 << 16 };
+
+  if( len <= 0 ) return true;
+  if( wp->stdio ) { if( fflush( wp->fp ) != 0 ) return false; wp->stdio = false; }
+#if defined __GLIBC__ && ( __GLIBC__ > 2 || __GLIBC_MINOR__ >= 27 )
+  if( wp->copy_ok && fd >= 0 && len >= copy_min )
+    {
+    if( !flush_slices( wp ) ) return false;
+    while( len > 0 )
+      {
+      const long n = copy_file_range( fd, &off, wp->fd, 0, len, 0 );
+      if( n > 0 ) { p += n; len -= n; continue; }
+      if( n < 0 && errno == EINTR ) continue;
+      if( n < 0 && errno != EXDEV && errno != EINVAL && errno != EBADF &&
+          errno != ENOSYS && errno != EOPNOTSUPP ) return false;
+      wp->copy_ok = false; break;		/* write the rest */
+      }
+    if( len <= 0 ) return true;
+    }
+#endif
+  if( fd >= 0 ) {}			/* keep compiler happy */
+  if( wp->n >= (int)( sizeof wp->iov / sizeof wp->iov[0] ) &&
+      !flush_slices( wp ) ) return false;
+  wp->iov[wp->n].iov_base = (void *)p;
+  wp->iov[wp->n++].iov_len = len;
+  return true;
+  }
+
+
+/* Write a range of lines to a stream. Lines whose text is mapped are
+   written straight from the mapping with writev, joining the lines that
+   are contiguous in the mapping; the others are written through 'fp'. */
 static long write_stream( const char * const filename, FILE * const fp,
                           int from, const int to )
   {
+  enum { batch_lines = 4096 };	/* lines written with interrupts disabled */
   line_t * lp = search_line_node( from );
   long size = 0;
+  wstate_t w;
+  bool ok = true;
 
-  while( from && from <= to )
-    {
-    int len;
-    char * p = get_sbuf_line( lp );
-    if( !p ) return -1;
-    len = lp->len;
-    if( from != last_addr() || !isbinary() || !unterminated_last_line() )
-      p[len++] = '\n';
-    size += len;
-    while( --len >= 0 )
-      if( fputc( *p++, fp ) == EOF )
+  w.fp = fp; w.fd = fileno( fp ); w.stdio = false; w.copy_ok = true; w.n = 0;
+  while( ok && from && from <= to )
+    {
+    const char * rp = 0;		/* current run of contiguous text */
+    long rlen = 0, roff = 0;
+    int rfd = -1;
+    disable_interrupts();
+    for( int i = 0; ok && i < batch_lines && from <= to; ++i )
+      {
+      int fd, len = lp->len;
+      long off;
+      if( from != last_addr() || !isbinary() || !unterminated_last_line() )
+        ++len;
+      size += len;
+      const char * const s = get_sbuf_mapped( lp, &fd, &off );
+      if( s && rp && s == rp + rlen &&
+          ( rfd < 0 ? fd < 0 : fd == rfd && off == roff + rlen ) )
+        rlen += len;				/* extend the run */
+      else
         {
-        show_strerror( filename, errno );
-        set_error_msg( "Cannot write file" );
-        return -1;
+        ok = write_run( &w, rp, rlen, rfd, roff );
+        rp = s; rlen = s ? len : 0; rfd = fd; roff = off;
+        if( ok && !s )
+          {
+          char * const p = get_sbuf_line( lp );
+          if( !p ) { ok = false; size = -1; break; }
+          p[lp->len] = '\n';
+          if( !w.stdio ) { ok = flush_slices( &w ); w.stdio = true; }
+          if( ok ) ok = ( (int)fwrite( p, 1, len, fp ) == len );
+          }
         }
-    ++from; lp = lp->q_forw;
+      ++from; lp = lp->q_forw;
+      }
+    if( ok ) ok = write_run( &w, rp, rlen, rfd, roff ) && flush_slices( &w );
+    enable_interrupts();
+    }
+  if( !ok )
+    {
+    if( size >= 0 )
+      {
+      show_strerror( filename, errno );
+      set_error_msg( "Cannot write file" );
+      }
+    return -1;
+    }
+  return size;
+  }
+
+
+/* If 'name' is a regular file read in place, and unchanged since then,
+   rewrite it only from the first byte that differs from the text of lines
+   'from' to 'to'. The file is then truncated to the size of the text.
+   Return the size of the text, -1 if error, or -2 if the file must be
+   written in full. */
+static long write_changes( const char * const filename, const char * const name,
+                           const int from, const int to )
+  {
+  struct stat st;
+  int addr;
+  long size = -1;
+
+  if( stat( name, &st ) != 0 || !S_ISREG( st.st_mode ) ) return -2;
+  const int src = leased_source( &st );
+  if( src < 0 ) return -2;
+  const bool last_nl =			/* last line is written with newline */
+    ( to != last_addr() || !isbinary() || !unterminated_last_line() );
+  const long pos = source_prefix( src, from, last_nl ? to : to - 1, &addr );
+  const int lfd = unlease_source( src, pos );
+  if( lfd < 0 ) return -1;
+  const int fd = open( name, O_WRONLY | O_CLOEXEC );
+  FILE * const fp = ( fd >= 0 ) ? fdopen( fd, "w" ) : 0;
+  if( !fp )
+    {
+    show_strerror( filename, errno );
+    set_error_msg( "Cannot open output file" );
+    if( fd >= 0 ) close( fd );
     }
+  else
+    {
+    bool ok = ( fseek( fp, pos, SEEK_SET ) == 0 );
+    long n = 0;
+    if( ok && addr && addr <= to )
+      { n = write_stream( filename, fp, addr, to ); ok = ( n >= 0 ); }
+    if( n >= 0 )
+      {
+      ok = ok && fflush( fp ) == 0 && ftruncate( fd, pos + n ) == 0 &&
+           futimens( fd, 0 ) == 0 &&	/* even if nothing was written */
+           ( !fsync_output() || fsync( fd ) == 0 );
+      if( fclose( fp ) != 0 ) ok = false;
+      if( ok ) size = pos + n;
+      else { show_strerror( filename, errno );
+             set_error_msg( "Cannot write file" ); }
+      }
+    else fclose( fp );			/* error already reported */
+    }
+  if( !renew_source_lease( src, lfd ) ) size = -1;
   return size;
   }
 
 
-/* write a range of lines to a named file/pipe; return line count */
+/* Open a temporary file in the directory of 'name', to be renamed to
+   '*targetp' ( 'name' with symbolic links resolved ) when written.
+   Return 0 if the file should be written in place instead. */
+static FILE * open_safe_save( const char * const name, char ** const targetp,
+                              char ** const tmpp )
+  {
+  struct stat st;
+  const bool exists = ( stat( name, &st ) == 0 );
+
+  if( exists && ( !S_ISREG( st.st_mode ) || st.st_nlink > 1 ) ) return 0;
+  char * const target = exists ? realpath( name, 0 ) : strdup( name );
+  if( !target ) return 0;
+  const int len = strlen( target );
+  char * const tmp = (char *)malloc( len + 8 );
+  int fd = -1;
+  if( tmp )
+    { memcpy( tmp, target, len ); memcpy( tmp + len, ".XXXXXX", 8 );
+      fd = mkstemp( tmp ); }
+  FILE * const fp = ( fd >= 0 ) ? fdopen( fd, "w" ) : 0;
+  if( !fp )
+    {
+    if( fd >= 0 ) { close( fd ); unlink( tmp ); }
+    free( tmp ); free( target ); return 0;
+    }
+  if( exists )
+    {
+    if( fchown( fd, st.st_uid, st.st_gid ) != 0 ) {}	/* best effort */
+    fchmod( fd, st.st_mode & 07777 );
+    }
+  else
+    { const mode_t mask = umask( 0 ); umask( mask ); fchmod( fd, 0666 & ~mask ); }
+  *targetp = target; *tmpp = tmp;
+  return fp;
+  }
+
+
+/* Write a range of lines to a named file/pipe; return line count.
+   With --safe-save, a regular file is written to a temporary file, which
+   then replaces it. */
 int write_file( const char * const filename, const char * const mode,
                 const int from, const int to )
   {
-  FILE * fp;
+  FILE * fp = 0;
+  char * target = 0;		/* file to be replaced by the temporary */
+  char * tmp = 0;
   long size;
   int ret;
 
-  if( *filename == '!' ) fp = popen( filename + 1, "w" );
+  if( *filename == '!' ) { sync_stdin(); fp = popen( filename + 1, "w" ); }
   else
     {
     const char * const stripped_name = strip_escapes( filename );
     if( !stripped_name ) return -1;
-    fp = fopen( stripped_name, mode );
+    if( safe_save() && *mode == 'w' )
+      fp = open_safe_save( stripped_name, &target, &tmp );
+    if( !fp && incremental_write() && *mode == 'w' )
+      {
+      size = write_changes( filename, stripped_name, from, to );
+      if( size == -1 ) return -1;
+      if( size >= 0 )
+        {
+        if( !scripted() ) printf( "%lu\n", size );
+        return ( from && from <= to ) ? to - from + 1 : 0;
+        }
+      }
+    if( !fp )
+      {
+      if( !copy_sources( stripped_name ) ) return -1;	/* before truncating */
+      fp = fopen( stripped_name, mode );
+      }
     }
   if( !fp )
     {
@@ -360,14 +831,269 @@ int write_file( const char * const filename, const char * const mode,
     return -1;
     }
   size = write_stream( filename, fp, from, to );
+  if( size >= 0 && fsync_output() && *filename != '!' &&
+      ( fflush( fp ) != 0 || fsync( fileno( fp ) ) != 0 ) )
+    {
+    show_strerror( filename, errno );
+    set_error_msg( "Cannot write file" );
+    size = -1;
+    }
   if( *filename == '!' ) ret = pclose( fp ); else ret = fclose( fp );
-  if( size < 0 ) return -1;
-  if( ret != 0 )
+  if( ret != 0 && size >= 0 )
     {
     show_strerror( filename, errno );
     set_error_msg( "Cannot close output file" );
-    return -1;
+    size = -1;
+    }
+  if( tmp )
+    {
+    if( size >= 0 && rename( tmp, target ) != 0 )
+      {
+      show_strerror( filename, errno );
+      set_error_msg( "Cannot rename output file" );
+      size = -1;
+      }
+    if( size < 0 ) unlink( tmp );
+    free( tmp ); free( target );
     }
+  if( size < 0 ) return -1;
   if( !scripted() ) printf( "%lu\n", size );
   return ( from && from <= to ) ? to - from + 1 : 0;
   }
+
+
+/* Start 'command' via sh, in a process group of its own, with pipes to
+   its standard input and output. Return its pid, or -1 if error. */
+static pid_t spawn_filter( const char * const command, int * const infdp,
+                           int * const outfdp )
+  {
+  extern char ** environ;
+  int in[2], out[2];			/* pipes to stdin and from stdout */
+  posix_spawn_file_actions_t fa;
+  posix_spawnattr_t attr;
+  sigset_t sigs;
+  pid_t pid;
+
+  if( pipe2( in, O_CLOEXEC ) != 0 ) return -1;
+  if( pipe2( out, O_CLOEXEC ) != 0 )
+    { const int e = errno; close( in[0] ); close( in[1] ); errno = e;
+      return -1; }
+  posix_spawn_file_actions_init( &fa );
+  posix_spawn_file_actions_adddup2( &fa, in[0], 0 );
+  posix_spawn_file_actions_adddup2( &fa, out[1], 1 );
+  posix_spawnattr_init( &attr );
+  sigemptyset( &sigs ); sigaddset( &sigs, SIGPIPE );
+  posix_spawnattr_setsigdefault( &attr, &sigs );	/* ignored by ed */
+  posix_spawnattr_setpgroup( &attr, 0 );	/* ed forwards SIGINT to it */
+  posix_spawnattr_setflags( &attr,
+                            POSIX_SPAWN_SETSIGDEF | POSIX_SPAWN_SETPGROUP );
+  char * const argv[] = { (char *)"sh", (char *)"-c", (char *)command, 0 };
+  const int err = posix_spawn( &pid, "/bin/sh", &fa, &attr, argv, environ );
+  posix_spawnattr_destroy( &attr );
+  posix_spawn_file_actions_destroy( &fa );
+  close( in[0] ); close( out[1] );
+  if( err != 0 )
+    { close( in[1] ); close( out[0] ); errno = err; return -1; }
+  fcntl( in[1], F_SETFL, fcntl( in[1], F_GETFL ) | O_NONBLOCK );
+  fcntl( out[0], F_SETFL, fcntl( out[0], F_GETFL ) | O_NONBLOCK );
+  *infdp = in[1]; *outfdp = out[0];
+  return pid;
+  }
+
+
+typedef struct			/* lines being written to a filter */
+  {
+  line_t * lp;			/* next line to be queued */
+  int left;			/* lines not yet queued */
+  struct iovec iov[1024];	/* queued text */
+  int iovi, iovn;		/* first and end of unwritten iovs */
+  line_t * qlp;			/* first line queued */
+  int qleft;			/* lines not yet queued before it */
+  long qdone;			/* bytes of the queue written */
+  long moves;			/* sbuf_map_moves() when queued */
+  char * buf;			/* copy of text not mapped */
+  int bufsz;
+  }
+fstate_t;
+
+
+/* Queue the text of the next lines of 'fs', pointing into the mapping
+   of the text if possible, and joining the lines contiguous in memory.
+   Interrupts must be disabled while the queue is used.
+   Return false if error. */
+static bool queue_filter_lines( fstate_t * const fs )
+  {
+  enum { copy_max = 65536 };	/* max size of text copied at a time */
+  const int iov_max = sizeof fs->iov / sizeof fs->iov[0];
+  int copied = 0;
+
+  fs->iovi = fs->iovn = 0;
+  fs->qlp = fs->lp; fs->qleft = fs->left; fs->qdone = 0;
+  fs->moves = sbuf_map_moves();
+  while( fs->left > 0 && fs->iovn < iov_max )
+    {
+    line_t * const lp = fs->lp;
+    const int len = lp->len + 1;
+    int fd;
+    long off;
+    const char * s = get_sbuf_mapped( lp, &fd, &off );
+    if( !s )
+      {
+      if( copied > 0 && copied + len > fs->bufsz ) break;	/* buf in use */
+      if( !resize_buffer( &fs->buf, &fs->bufsz, max( len, copy_max ) ) )
+        return false;
+      const char * const t = get_sbuf_text( lp );
+      if( !t ) return false;
+      memcpy( fs->buf + copied, t, len );
+      s = fs->buf + copied; copied += len;
+      }
+    struct iovec * vp = fs->iovn ? &fs->iov[fs->iovn-1] : 0;
+    if( vp && (const char *)vp->iov_base + vp->iov_len == s )
+      vp->iov_len += len;
+    else
+      { vp = &fs->iov[fs->iovn++]; vp->iov_base = (void *)s; vp->iov_len = len; }
+    fs->lp = lp->q_forw; --fs->left;
+    }
+  return true;
+  }
+
+
+/* drop from the queue of 'fs' the first n bytes, already written */
+static void skip_filter_text( fstate_t * const fs, long n )
+  {
+  fs->qdone += n;
+  while( n > 0 && fs->iovi < fs->iovn )
+    {
+    struct iovec * const vp = &fs->iov[fs->iovi];
+    if( (unsigned long)n >= vp->iov_len ) { n -= vp->iov_len; ++fs->iovi; }
+    else
+      { vp->iov_base = (char *)vp->iov_base + n; vp->iov_len -= n; n = 0; }
+    }
+  }
+
+
+/* The scratch file was remapped elsewhere ( by SIGIO ) since the text of
+   'fs' was queued; queue the same lines again, skipping what was written.
+   Return false if error. */
+static bool requeue_filter_lines( fstate_t * const fs )
+  {
+  const long done = fs->qdone;
+  fs->lp = fs->qlp; fs->left = fs->qleft;
+  if( !queue_filter_lines( fs ) ) return false;
+  skip_filter_text( fs, done );
+  return true;
+  }
+
+
+/* write to fd as much of the queued text of 'fs' as the pipe accepts */
+static bool write_filter_lines( fstate_t * const fs, const int fd )
+  {
+  const long n = writev( fd, fs->iov + fs->iovi, fs->iovn - fs->iovi );
+  if( n < 0 ) return errno == EAGAIN || errno == EINTR;
+  skip_filter_text( fs, n );
+  return true;
+  }
+
+
+/* Replace lines from..to by the output of 'command' run with them as its
+   input. The lines are written to the command while its output is read,
+   so that no pipe can fill up and block both. The buffer is not changed
+   unless the command exits with status 0. Interrupts are only disabled
+   while reading the lines and changing the buffer; SIGINT is sent to the
+   command, and interrupts ed once the command exits. Return false if
+   error. */
+bool filter_lines( const char * const command, const int from, const int to,
+                   const bool isglobal )
+  {
+  static fstate_t fs;
+  static char * rbuf = 0;		/* output of command */
+  static int rbufsz = 0;
+  enum { read_min = 65536 };		/* min space for a read */
+  int wfd, rfd, status = 0;
+  long size = 0;
+  bool ok = true;
+
+  fflush( stdout );
+  struct sigaction old_pipe, ign_pipe;
+  ign_pipe.sa_handler = SIG_IGN; sigemptyset( &ign_pipe.sa_mask );
+  ign_pipe.sa_flags = 0;
+  sigaction( SIGPIPE, &ign_pipe, &old_pipe );	/* get EPIPE instead */
+  const pid_t pid = spawn_filter( command, &wfd, &rfd );
+  if( pid < 0 )
+    {
+    show_strerror( 0, errno );
+    sigaction( SIGPIPE, &old_pipe, 0 );
+    set_error_msg( "Can't create shell process" ); return false;
+    }
+  forward_interrupts( pid );
+  fs.lp = search_line_node( from ); fs.left = to - from + 1;
+  fs.iovi = fs.iovn = 0;
+  while( rfd >= 0 )
+    {
+    if( wfd >= 0 && fs.iovi >= fs.iovn )
+      {
+      if( fs.left <= 0 ) { close( wfd ); wfd = -1; }	/* EOF for command */
+      else
+        {
+        disable_interrupts();		/* the queue points into mappings */
+        ok = queue_filter_lines( &fs );
+        enable_interrupts();
+        if( !ok ) break;
+        }
+      }
+    struct pollfd pfd[2];
+    pfd[0].fd = rfd; pfd[0].events = POLLIN;
+    pfd[1].fd = wfd; pfd[1].events = POLLOUT;	/* ignored if wfd < 0 */
+    if( poll( pfd, 2, -1 ) < 0 )
+      { if( errno == EINTR ) continue;
+        show_strerror( 0, errno ); ok = false; break; }
+    if( wfd >= 0 && pfd[1].revents )
+      {
+      disable_interrupts();
+      if( fs.moves != sbuf_map_moves() ) ok = requeue_filter_lines( &fs );
+      const bool written = ok && write_filter_lines( &fs, wfd );
+      enable_interrupts();
+      if( !ok ) break;
+      if( !written )
+        {
+        if( errno != EPIPE )		/* EPIPE: command stopped reading */
+          { show_strerror( 0, errno ); ok = false; break; }
+        close( wfd ); wfd = -1;
+        }
+      }
+    if( !pfd[0].revents ) continue;
+    if( !resize_buffer( &rbuf, &rbufsz, size + read_min ) )
+      { ok = false; break; }
+    const long n = read( rfd, rbuf + size, rbufsz - size );
+    if( n > 0 ) size += n;
+    else if( n == 0 ) { close( rfd ); rfd = -1; }
+    else if( errno != EAGAIN && errno != EINTR )
+      { show_strerror( 0, errno ); ok = false; break; }
+    }
+  if( wfd >= 0 ) close( wfd );
+  if( rfd >= 0 ) close( rfd );
+  while( waitpid( pid, &status, 0 ) < 0 && errno == EINTR ) {}
+  forward_interrupts( 0 );
+  sigaction( SIGPIPE, &old_pipe, 0 );
+  disable_interrupts();
+  if( ok && ( !WIFEXITED( status ) || WEXITSTATUS( status ) != 0 ) )
+    { set_error_msg( "Filter command failed" ); ok = false; }
+  if( ok && size > 0 && rbuf[size-1] != '\n' )
+    {
+    if( resize_buffer( &rbuf, &rbufsz, size + 1 ) )
+      { rbuf[size++] = '\n'; fputs( "Newline appended\n", stdout ); }
+    else ok = false;
+    }
+  if( ok && size > 0 && memchr( rbuf, 0, size ) ) set_binary();
+  if( ok ) ok = delete_lines( from, to, isglobal );
+  if( ok && size > 0 )
+    {
+    set_current_addr( from - 1 );
+    ok = put_sbuf_lines( rbuf, size );
+    if( current_addr() >= from &&		/* record even a partial put */
+        !push_undo_atom( UADD, from, current_addr() ) ) ok = false;
+    }
+  enable_interrupts();
+  if( ok && !scripted() ) printf( "%lu\n", size );
+  return ok;
+  }
@@ -0,0 +1,349 @@
+/* journal.c: crash-recovery journal routines for the ed line editor. */
+/* GNU ed - The GNU line editor.
+   Copyright (C) 2006-2022 Antonio Diaz Diaz.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/*
+   The journal records every change to the editor buffer since the last
+   checkpoint, as the primitive operations done on the buffer, in the
+   order they are done. Deletions, moves and copies of ranges of lines
+   are recorded by their addresses, and insertions by the new text.
+   Undo and redo are recorded as the operations they do.
+
+   A checkpoint truncates the journal and writes a header naming a base
+   file, whose contents were the whole buffer at that moment ( the file
+   just read by 'e', or just written by 'w' ). If there is no such file,
+   the whole buffer is recorded after the header instead.
+
+   The records of a command are flushed when the command finishes, so
+   that hangup only needs to flush the last ones. 'ed --recover' reads
+   the base file and replays the records onto it.
+
+   Journal format:
+     "ed journal\n"
+     "B <size> <mtime sec> <mtime nsec> <name length>\n<name>\n" or "B -\n"
+   followed by any number of the records:
+     "d <from> <to>\n"			delete lines
+     "m <from> <to> <addr>\n"		move lines to after addr
+     "t <from> <to> <addr>\n"		copy lines to after addr
+     "a <addr> <size>\n<text>"		insert lines of text after addr
+*/
+
+#include <errno.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "ed.h"
+
+
+static const char * const magic = "ed journal\n";
+static FILE * jfp = 0;			/* journal file */
+static char * jname = 0;		/* journal file name */
+static bool jpaused = false;		/* don't record changes */
+static bool jdirty = false;		/* records not yet flushed */
+static char * jbase = 0;		/* base file of the last checkpoint */
+static struct stat jbase_st;		/* its size and mtime then */
+
+
+bool journal_active( void ) { return jfp && !jpaused; }
+
+
+/* Return true if there is no base file, or if it still has the size
+   and mtime recorded at the last checkpoint; else the journal can't be
+   replayed onto it. */
+bool journal_base_intact( void )
+  {
+  struct stat st;
+
+  if( !jbase ) return true;
+  return stat( jbase, &st ) == 0 && st.st_size == jbase_st.st_size &&
+         st.st_mtim.tv_sec == jbase_st.st_mtim.tv_sec &&
+         st.st_mtim.tv_nsec == jbase_st.st_mtim.tv_nsec;
+  }
+
+
+/* return true if changes are being recorded; the caller records one */
+static bool journaling( void )
+  {
+  if( !jfp || jpaused ) return false;
+  jdirty = true;
+  return true;
+  }
+
+
+/* Stop journaling after an error, leaving the journal for recovery of
+   what was recorded. */
+static void journal_error( void )
+  {
+  show_strerror( jname, errno );
+  fputs( "Journal disabled\n", stderr );
+  fclose( jfp ); jfp = 0;
+  }
+
+
+static void journal_record( const char type, const int a, const int b,
+                            const int c )
+  {
+  if( !journaling() ) return;
+  const int n = ( type == 'd' ) ? fprintf( jfp, "d %d %d\n", a, b ) :
+                fprintf( jfp, "%c %d %d %d\n", type, a, b, c );
+  if( n < 0 ) journal_error();
+  }
+
+
+/* record the deletion of lines from..to */
+void journal_delete( const int from, const int to )
+  { if( from <= to ) journal_record( 'd', from, to, 0 ); }
+
+/* record the move of lines from..to to after addr */
+void journal_move( const int from, const int to, const int addr )
+  { journal_record( 'm', from, to, addr ); }
+
+/* record the copy of lines from..to to after addr */
+void journal_copy( const int from, const int to, const int addr )
+  { journal_record( 't', from, to, addr ); }
+
+
+/* record the insertion after addr of 'size' bytes of complete lines */
+void journal_text( const int addr, const char * const text, const long size )
+  {
+  if( !journaling() || size <= 0 ) return;
+  if( fprintf( jfp, "a %d %ld\n", addr, size ) < 0 ||
+      (long)fwrite( text, 1, size, jfp ) != size ) journal_error();
+  }
+
+
+/* record the insertion after addr of a line of 'len' bytes */
+void journal_line( const int addr, const char * const text, const int len )
+  {
+  if( !journaling() ) return;
+  if( fprintf( jfp, "a %d %d\n", addr, len + 1 ) < 0 ||
+      (int)fwrite( text, 1, len, jfp ) != len || putc( '\n', jfp ) == EOF )
+    journal_error();
+  }
+
+
+/* stop recording changes until the next checkpoint */
+void pause_journal( void ) { jpaused = true; }
+
+
+/* Truncate the journal and make 'filename' its base, if it is a regular
+   file holding the buffer. Else record the whole buffer. */
+void checkpoint_journal( const char * const filename )
+  {
+  struct stat st;
+  char * path = 0;
+
+  if( !jfp ) return;
+  jpaused = false;
+  if( fflush( jfp ) != 0 || ftruncate( fileno( jfp ), 0 ) != 0 )
+    { journal_error(); return; }
+  rewind( jfp );
+  const char * const name = ( filename && filename[0] != '!' ) ?
+                            strip_escapes( filename ) : 0;
+  if( name && name[0] && stat( name, &st ) == 0 && S_ISREG( st.st_mode ) )
+    path = realpath( name, 0 );
+  char * const old_base = jbase;
+  jbase = 0; free( old_base ); jbase = path;
+  if( path ) jbase_st = st;
+  bool ok = fputs( magic, jfp ) >= 0;
+  if( path )
+    {
+    ok = ok && fprintf( jfp, "B %lld %lld %ld %d\n%s\n",
+                        (long long)st.st_size, (long long)st.st_mtim.tv_sec,
+                        (long)st.st_mtim.tv_nsec, (int)strlen( path ),
+                        path ) >= 0;
+    }
+  else
+    {
+    ok = ok && fputs( "B -\n", jfp ) >= 0;
+    const line_t * lp = search_line_node( 1 );
+    for( int addr = 1; ok && addr <= last_addr(); ++addr, lp = lp->q_forw )
+      {
+      disable_interrupts();
+      const char * const s = get_sbuf_text( lp );
+      if( s ) journal_line( addr - 1, s, lp->len );
+      enable_interrupts();
+      ok = s && jfp;
+      }
+    if( !jfp ) return;
+    }
+  if( !ok ) { journal_error(); return; }
+  jdirty = true;
+  flush_journal();
+  }
+
+
+/* Open the journal; appending to it if 'append', else starting it with
+   a checkpoint of base file 'filename'. Return false if error. */
+bool open_journal( const char * const name, const char * const filename,
+                   const bool append )
+  {
+  static char buf[65536];
+
+  jname = (char *) malloc( strlen( name ) + 1 );
+  if( !jname ) { show_strerror( 0, ENOMEM ); return false; }
+  strcpy( jname, name );
+  jfp = fopen( name, append ? "a" : "w" );
+  if( !jfp ) { show_strerror( name, errno ); return false; }
+  setvbuf( jfp, buf, _IOFBF, sizeof buf );
+  if( !append ) checkpoint_journal( filename );
+  return jfp != 0;
+  }
+
+
+/* write the records of the last command; return false if error */
+bool flush_journal( void )
+  {
+  if( !jfp ) return false;
+  if( !jdirty ) return true;
+  jdirty = false;
+  if( fflush( jfp ) != 0 || ( fsync_output() && fdatasync( fileno( jfp ) ) != 0 ) )
+    { journal_error(); return false; }
+  return true;
+  }
+
+
+/* close the journal at exit; it is no longer needed for recovery */
+void close_journal( void )
+  {
+  if( !jname ) return;
+  if( jfp ) { fclose( jfp ); jfp = 0; }
+  unlink( jname );
+  }
+
+
+/* read a record header of the journal into buf; return its length */
+static int read_header( const char * const p, const char * const end,
+                        char * const buf, const int size )
+  {
+  const char * const q =
+    (const char *) memchr( p, '\n', min( (long)( end - p ), (long)size - 1 ) );
+  if( !q ) return 0;
+  const int len = q + 1 - p;
+  memcpy( buf, p, len ); buf[len] = 0;
+  return len;
+  }
+
+
+/* Replay the records of a journal mapped at [p,end) onto the buffer.
+   Return the number of records replayed, or -1 if one is invalid. */
+static long replay_records( const char * p, const char * const end )
+  {
+  char buf[80];
+  long records = 0;
+  int len;
+
+  while( ( len = read_header( p, end, buf, sizeof buf ) ) > 0 )
+    {
+    int a, b, c;
+    long size;
+    p += len;
+    if( buf[0] == 'd' && sscanf( buf, "d %d %d", &a, &b ) == 2 &&
+        a >= 1 && a <= b && b <= last_addr() )
+      { if( !delete_lines( a, b, false ) ) return -1; }
+    else if( ( buf[0] == 'm' || buf[0] == 't' ) &&
+             sscanf( buf + 1, "%d %d %d", &a, &b, &c ) == 3 &&
+             a >= 1 && a <= b && b <= last_addr() && c >= 0 &&
+             c <= last_addr() && ( buf[0] == 't' || c < a || c >= b ) )
+      {
+      if( buf[0] == 'm' ? !move_lines( a, b, c, false ) :
+                          !copy_lines( a, b, c ) ) return -1;
+      }
+    else if( buf[0] == 'a' && sscanf( buf, "a %d %ld", &a, &size ) == 2 &&
+             a >= 0 && a <= last_addr() && size > 0 )
+      {
+      if( size > end - p ) break;	/* record truncated by a crash */
+      if( p[size-1] != '\n' ) return -1;
+      set_current_addr( a );
+      disable_interrupts();
+      const bool ok = put_sbuf_lines( p, size );
+      enable_interrupts();
+      if( !ok ) return -1;
+      p += size;
+      }
+    else return -1;
+    ++records;
+    }
+  return records;
+  }
+
+
+/* Rebuild the buffer from a journal. Return the name of its base file
+   ( "" if none ), or 0 if error. */
+const char * recover_journal( const char * const name )
+  {
+  static char * base = 0;
+  struct stat st;
+  const int fd = open( name, O_RDONLY );
+
+  if( fd < 0 || fstat( fd, &st ) != 0 )
+    { show_strerror( name, errno ); if( fd >= 0 ) close( fd ); return 0; }
+  const long jsize = st.st_size;
+  const long mlen = strlen( magic );
+  const char * const map = ( jsize > mlen ) ? (const char *)
+    mmap( 0, jsize, PROT_READ, MAP_PRIVATE, fd, 0 ) : (const char *)MAP_FAILED;
+  close( fd );
+  if( map == MAP_FAILED || memcmp( map, magic, mlen ) != 0 )
+    { if( map != MAP_FAILED ) munmap( (void *)map, jsize );
+      fprintf( stderr, "%s: Not a journal file\n", name ); return 0; }
+  const char * p = map + mlen;
+  const char * const end = map + jsize;
+  char buf[80];
+  long long bsize = 0, sec = 0;
+  long nsec = 0;
+  int len = read_header( p, end, buf, sizeof buf ), nlen = 0;
+  bool ok = len > 0;
+
+  if( ok && strcmp( buf, "B -\n" ) != 0 )
+    ok = ( sscanf( buf, "B %lld %lld %ld %d", &bsize, &sec, &nsec, &nlen ) == 4 &&
+           nlen > 0 && nlen < end - p - len && p[len+nlen] == '\n' );
+  if( ok ) p += len;
+  free( base ); base = ok ? (char *) malloc( 2 * nlen + 1 ) : 0;
+  if( ok && base )
+    {
+    int i = 0;
+    for( int j = 0; j < nlen; ++j )	/* escape backslashes for read_file */
+      { if( p[j] == '\\' ) base[i++] = '\\'; base[i++] = p[j]; }
+    base[i] = 0; p += nlen ? nlen + 1 : 0;
+    }
+  if( ok && base && nlen )
+    {
+    const char * const path = strip_escapes( base );
+    if( !path || stat( path, &st ) != 0 || st.st_size != bsize ||
+        st.st_mtim.tv_sec != sec || st.st_mtim.tv_nsec != nsec )
+      {
+      fprintf( stderr, "%s: Base file '%s' has changed or is missing\n",
+               name, path ? path : "" );
+      munmap( (void *)map, jsize ); return 0;
+      }
+    jbase = realpath( path, 0 );	/* appended records go on this base */
+    jbase_st = st;
+    if( read_file( base, 0 ) < 0 ) { munmap( (void *)map, jsize ); return 0; }
+    }
+  const long records = ( ok && base ) ? replay_records( p, end ) : -1;
+  munmap( (void *)map, jsize );
+  if( records < 0 )
+    { fprintf( stderr, "%s: Corrupt journal\n", name ); return 0; }
+  reset_undo_state();
+  set_modified( records > 0 );
+  return base;
+  }
@@ -38,8 +38,13 @@
 #include <clocale>
 #include <iostream>
 #include <span>
+#include <vector>
 
+#include <cerrno>
+#include <fcntl.h>
 #include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 #include "carg_parser.h"
 #include "ed.h"
@@ -57,6 +62,46 @@ auto extended_regexp( bool set, bool new_val ) -> bool {
 }
 
 
+/* if set, flush written files to disk */
+auto fsync_output( bool set, bool new_val ) -> bool {
+  static bool fsync_output = false;
+
+  if( set ) { fsync_output = new_val; }
+
+  return fsync_output;
+}
+
+
+/* if set, 'w' rewrites a file read in place only from its first change */
+auto incremental_write( bool set, bool new_val ) -> bool {
+  static bool incremental_write = false;
+
+  if( set ) { incremental_write = new_val; }
+
+  return incremental_write;
+}
+
+
+/* if set, index the lines of the files edited as they are needed */
+auto lazy_index( bool set, bool new_val ) -> bool {
+  static bool lazy_index = false;
+
+  if( set ) { lazy_index = new_val; }
+
+  return lazy_index;
+}
+
+
+/* if set, read regular files in place instead of copying them */
+auto map_input( bool set, bool new_val ) -> bool {
+  static bool map_input = false;
+
+  if( set ) { map_input = new_val; }
+
+  return map_input;
+}
+
+
 /* if set, run in restricted mode */
 auto restricted( bool set, bool new_val ) -> bool {
   static bool restricted = false;
@@ -67,6 +112,16 @@ auto restricted( bool set, bool new_val ) -> bool {
 }
 
 
+/* if set, write files to a temporary file and rename it */
+auto safe_save( bool set, bool new_val ) -> bool {
+  static bool safe_save = false;
+
+  if( set ) { safe_save = new_val; }
+
+  return safe_save;
+}
+
+
 /* if set, suppress diagnostics, byte counts and '!' prompt */
 auto scripted( bool set, bool new_val ) -> bool {
   static bool scripted = false;
@@ -77,6 +132,26 @@ auto scripted( bool set, bool new_val ) -> bool {
 }
 
 
+/* if set, print statistics on exit */
+auto stats( bool set, bool new_val ) -> bool {
+  static bool stats = false;
+
+  if( set ) { stats = new_val; }
+
+  return stats;
+}
+
+
+/* if set, use a stdio stream instead of a mapping for the scratch file */
+auto stdio_scratch( bool set, bool new_val ) -> bool {
+  static bool stdio_scratch = false;
+
+  if( set ) { stdio_scratch = new_val; }
+
+  return stdio_scratch;
+}
+
+
 /* if set, strip trailing CRs */
 auto strip_cr( bool set, bool new_val ) -> bool {
   static bool strip_cr = false;
@@ -87,6 +162,16 @@ auto strip_cr( bool set, bool new_val ) -> bool {
 }
 
 
+/* if set, 'e' reads only the lines appended to the file edited */
+auto tail_reload( bool set, bool new_val ) -> bool {
+  static bool tail_reload = false;
+
+  if( set ) { tail_reload = new_val; }
+
+  return tail_reload;
+}
+
+
 /* if set, be backwards compatible */
 auto traditional( bool set, bool new_val ) -> bool {
   static bool traditional = false;
@@ -116,7 +201,24 @@ static void show_help( const char * invocation_name ) {
     "  -r, --restricted           run in restricted mode\n"
     "  -s, --quiet, --silent      suppress diagnostics, byte counts and '!' prompt\n"
     "  -v, --verbose              be verbose; equivalent to the 'H' command\n"
+    "      --batch=SCRIPT         run SCRIPT on each file given, or read from stdin\n"
+    "      --fsync                flush written files to disk before closing them\n"
+    "      --incremental-write    rewrite files read in place from the first change\n"
+    "      --jobs=N               edit up to N files at once in batch mode\n"
+    "      --journal=FILE         record the changes in FILE for crash recovery\n"
+    "      --lazy-index           index the lines of the file edited as needed\n"
+    "      --map-input            read files in place instead of copying them\n"
+    "      --recover=FILE         rebuild the buffer from journal FILE\n"
+    "      --regex-cache=N        keep up to N compiled regexps (default 64)\n"
+    "      --regex-matcher=KIND   match regexps by 'locale', 'bytes' or 'auto'\n"
+    "      --safe-save            write files atomically through a temporary file\n"
+    "      --stats[=histogram]    print command, buffer and regex statistics on exit\n"
+    "      --stdio-scratch        don't memory-map the scratch file\n"
     "      --strip-trailing-cr    strip carriage returns at end of text lines\n"
+    "      --tail-reload          'e' reads only the lines appended to the file\n"
+    "      --threads=N            use up to N threads to match long ranges\n"
+    "      --undo-levels=N        keep up to N commands for undo and redo (U)\n"
+    "      --undo-memory=N        memory limit of the undo levels, in MiB (64)\n"
     "\nStart edit by reading in 'file' if given.\n"
     "If 'file' begins with a '!', read output of shell command.\n"
     "\nExit status: 0 for a normal exit, 1 for environmental problems (file\n"
@@ -188,6 +290,151 @@ auto may_access_filename( const char * const name ) -> bool {
 }
 
 
+static auto set_regex_cache( const char * const arg ) -> bool {
+  char * tail = nullptr;
+  const long size = strtol( arg, &tail, 10 );
+
+  if( tail == arg || *tail != 0 || size < 1 || size > 65536 ) { return false; }
+  set_regex_cache_size( static_cast<int>( size ) );
+  return true;
+}
+
+
+static auto set_matcher( const char * const arg ) -> bool {
+  if( strcmp( arg, "auto" ) == 0 ) { set_regex_matcher( rm_auto ); }
+  else if( strcmp( arg, "locale" ) == 0 ) { set_regex_matcher( rm_locale ); }
+  else if( strcmp( arg, "bytes" ) == 0 ) { set_regex_matcher( rm_bytes ); }
+  else { return false; }
+  return true;
+}
+
+
+static auto set_threads( const char * const arg ) -> bool {
+  char * tail = nullptr;
+  const long n = strtol( arg, &tail, 10 );
+
+  if( tail == arg || *tail != 0 || n < 1 || n > 256 ) { return false; }
+  set_match_threads( static_cast<int>( n ) );
+  return true;
+}
+
+
+/* set the number of undo levels, or their memory limit in MiB */
+static auto set_undo( const char * const arg, const bool memory ) -> bool {
+  char * tail = nullptr;
+  const long n = strtol( arg, &tail, 10 );
+
+  if( tail == arg || *tail != 0 || n < 1 || n > ( memory ? 1L << 20 : 1L << 24 ) ) {
+    return false;
+  }
+  if( memory ) {
+    set_undo_memory( n << 20 );
+  } else {
+    set_undo_levels( static_cast<int>( n ) );
+  }
+  return true;
+}
+
+
+static auto set_jobs( const char * const arg, int * const jobs ) -> bool {
+  char * tail = nullptr;
+  const long n = strtol( arg, &tail, 10 );
+
+  if( tail == arg || *tail != 0 || n < 1 || n > 1024 ) { return false; }
+  *jobs = static_cast<int>( n );
+  return true;
+}
+
+
+/* read a list of NUL-separated filenames from stdin */
+static auto read_batch_names( vector<char> & text, vector<const char *> & names ) -> bool {
+  size_t size = 0;
+  while( true ) {
+    if( text.size() < size + 65536 ) { text.resize( 2 * text.size() + 65536 ); }
+    const long n = read( 0, text.data() + size, text.size() - size );
+    if( n == 0 ) { break; }
+    if( n < 0 ) {
+      if( errno == EINTR ) { continue; }
+      show_strerror( "stdin", errno ); return false;
+    }
+    size += n;
+  }
+  if( size > 0 && text[size-1] != 0 ) { text[size++] = 0; }	/* room left */
+  for( size_t i = 0; i < size; i += strlen( text.data() + i ) + 1 ) {
+    if( text[i] != 0 ) { names.push_back( text.data() + i ); }
+  }
+  return true;
+}
+
+
+/* report the exit status of the child editing 'name'; return it */
+static auto batch_status( const char * const name, const int status ) -> int {
+  if( WIFEXITED( status ) && WEXITSTATUS( status ) == 0 ) { return 0; }
+  if( WIFEXITED( status ) ) {
+    cerr << name << ": exit status " << WEXITSTATUS( status ) << "\n";
+    return WEXITSTATUS( status );
+  }
+  cerr << name << ": killed by signal " << WTERMSIG( status ) << "\n";
+  return 1;
+}
+
+
+/* Batch mode. The script is run on each file by a child process forked
+   after the options have been parsed, so that each file gets a fresh
+   editor without starting a new program. A child reads the script as
+   its own stdin, as 'ed file < script' would. Up to 'jobs' children run
+   at once, and the exit status of each one that fails is reported.
+   Return -1 in a child, with *filep set to its file. Else return the
+   highest exit status of the children. */
+static auto run_batch( const char * const script, vector<const char *> & names,
+                       int jobs, const char ** const filep ) -> int {
+  static vector<char> text;		/* names read from stdin */
+  vector<pair<pid_t, const char *> > running;
+  int retval = 0;
+
+  const int fd = open( script, O_RDONLY );
+  if( fd < 0 ) { show_strerror( script, errno ); return 1; }
+  close( fd );
+  if( names.empty() && !read_batch_names( text, names ) ) { return 1; }
+  if( jobs <= 0 ) { jobs = static_cast<int>( max( 1L, sysconf( _SC_NPROCESSORS_ONLN ) ) ); }
+  for( size_t i = 0; i < names.size() || !running.empty(); ) {
+    if( i < names.size() && static_cast<int>( running.size() ) < jobs ) {
+      fflush( stdout );
+      const pid_t pid = fork();
+      if( pid == 0 ) {
+	const int sfd = open( script, O_RDONLY );
+	if( sfd < 0 || dup2( sfd, 0 ) < 0 ) { show_strerror( script, errno ); _exit( 1 ); }
+	close( sfd );
+	if( jobs > 1 ) { setvbuf( stdout, nullptr, _IOFBF, BUFSIZ ); }
+	*filep = names[i];
+	return -1;
+      }
+      if( pid < 0 ) { show_strerror( nullptr, errno ); retval = 1; break; }
+      running.emplace_back( pid, names[i++] );
+      continue;
+    }
+    int status = 0;
+    const pid_t pid = wait( &status );
+    if( pid < 0 ) { if( errno == EINTR ) { continue; } break; }
+    for( size_t j = 0; j < running.size(); ++j ) {
+      if( running[j].first == pid ) {
+	const int st = batch_status( running[j].second, status );
+	retval = max( retval, st );
+	running[j] = running.back(); running.pop_back(); break;
+      }
+    }
+  }
+  while( !running.empty() ) {		/* after an error of fork */
+    int status = 0;
+    if( waitpid( running.back().first, &status, 0 ) < 0 && errno == EINTR ) { continue; }
+    const int st = batch_status( running.back().second, status );
+    retval = max( retval, st );
+    running.pop_back();
+  }
+  return retval;
+}
+
+
 auto main( const int argc, const char * const argv[] ) -> int {
   const char * const program_name = "ed";
   const char * const program_year = "2022";
@@ -198,7 +445,15 @@ auto main( const int argc, const char * const argv[] ) -> int {
   int argind = 0;
   bool initial_error = false;		/* fatal error reading file */
   bool loose = false;
-  enum { opt_cr = 256 };
+  const char * journal_name = nullptr;
+  const char * recover_name = nullptr;
+  const char * base_name = nullptr;	/* file holding the initial buffer */
+  const char * batch_script = nullptr;
+  const char * batch_file = nullptr;	/* file of this batch child */
+  int jobs = 0;				/* max batch children at once */
+  bool histogram = false;		/* print latency histograms */
+  enum { opt_ba = 256, opt_cr, opt_fs, opt_iw, opt_jb, opt_jo, opt_li, opt_mi, opt_rc,
+         opt_re, opt_rm, opt_sa, opt_ss, opt_st, opt_th, opt_tr, opt_ul, opt_um };
   const struct ap_Option options[] =
     {
       { 'E', "extended-regexp",      ap_no  },
@@ -211,7 +466,24 @@ auto main( const int argc, const char * const argv[] ) -> int {
       { 's', "silent",               ap_no  },
       { 'v', "verbose",              ap_no  },
       { 'V', "version",              ap_no  },
+      { opt_ba, "batch",             ap_yes },
       { opt_cr, "strip-trailing-cr", ap_no  },
+      { opt_fs, "fsync",             ap_no  },
+      { opt_iw, "incremental-write", ap_no  },
+      { opt_jb, "jobs",              ap_yes },
+      { opt_jo, "journal",           ap_yes },
+      { opt_li, "lazy-index",        ap_no  },
+      { opt_mi, "map-input",         ap_no  },
+      { opt_rc, "regex-cache",       ap_yes },
+      { opt_re, "recover",           ap_yes },
+      { opt_rm, "regex-matcher",     ap_yes },
+      { opt_sa, "safe-save",         ap_no  },
+      { opt_ss, "stdio-scratch",     ap_no  },
+      { opt_st, "stats",             ap_maybe },
+      { opt_th, "threads",           ap_yes },
+      { opt_tr, "tail-reload",       ap_no  },
+      { opt_ul, "undo-levels",       ap_yes },
+      { opt_um, "undo-memory",       ap_yes },
       {  0, nullptr,                       ap_no } };
 
   struct Arg_parser parser {};
@@ -243,26 +515,100 @@ auto main( const int argc, const char * const argv[] ) -> int {
 	case 's': scripted(true, true); break;
 	case 'v': set_verbose(); break;
 	case 'V': show_version( program_name, program_year ); return 0;
+	case opt_ba: batch_script = arg; break;
 	case opt_cr: strip_cr(true, true); break;
+	case opt_fs: fsync_output(true, true); break;
+	case opt_iw: incremental_write(true, true); break;
+	case opt_jb: if( !set_jobs( arg, &jobs ) ) {
+	    show_error( "Invalid number of jobs.", 0, true, program_name, invocation_name );
+	    return 1;
+	  }
+	  break;
+	case opt_jo: journal_name = arg; break;
+	case opt_li: lazy_index(true, true); break;
+	case opt_mi: map_input(true, true); break;
+	case opt_rc: if( !set_regex_cache( arg ) ) {
+	    show_error( "Invalid regex cache size.", 0, true, program_name, invocation_name );
+	    return 1;
+	  }
+	  break;
+	case opt_re: recover_name = arg; break;
+	case opt_rm: if( !set_matcher( arg ) ) {
+	    show_error( "Invalid regex matcher.", 0, true, program_name, invocation_name );
+	    return 1;
+	  }
+	  break;
+	case opt_sa: safe_save(true, true); break;
+	case opt_ss: stdio_scratch(true, true); break;
+	case opt_st: if( arg_arr[0] && strcmp( arg, "histogram" ) != 0 ) {
+	    show_error( "Invalid argument of --stats.", 0, true, program_name, invocation_name );
+	    return 1;
+	  }
+	  stats(true, true); histogram = ( arg_arr[0] != 0 ); break;
+	case opt_th: if( !set_threads( arg ) ) {
+	    show_error( "Invalid number of threads.", 0, true, program_name, invocation_name );
+	    return 1;
+	  }
+	  break;
+	case opt_tr: tail_reload(true, true); break;
+	case opt_ul: if( !set_undo( arg, false ) ) {
+	    show_error( "Invalid number of undo levels.", 0, true, program_name, invocation_name );
+	    return 1;
+	  }
+	  break;
+	case opt_um: if( !set_undo( arg, true ) ) {
+	    show_error( "Invalid undo memory limit.", 0, true, program_name, invocation_name );
+	    return 1;
+	  }
+	  break;
 	default : show_error( "internal error: uncaught option.", 0, false, program_name, invocation_name );
 	  return 3;
 	}
     } /* end process options */
 
   setlocale( LC_ALL, "" );
+  if( batch_script != nullptr )
+    {
+      if( journal_name != nullptr || recover_name != nullptr )
+	{ show_error( "--batch can't be used with --journal or --recover.", 0, true, program_name, invocation_name );
+	  return 1; }
+      vector<const char *> names;
+      for( ; argind < ap_arguments( &parser ); ++argind )
+	{
+	  const char * const arg = ap_argument( &parser, argind );
+	  if( strcmp( arg, "-" ) == 0 ) { scripted(true, true); }
+	  else { names.push_back( arg ); }
+	}
+      const int retval = run_batch( batch_script, names, jobs, &batch_file );
+      if( retval >= 0 ) { ap_free( &parser ); return retval; }
+    }
   if( !init_buffers() ) { return 1; }
 
-  while( argind < ap_arguments( &parser ) )
+  if( recover_name != nullptr )		/* the journal names the file */
     {
-      const char * const arg = ap_argument( &parser, argind );
+      if( argind < ap_arguments( &parser ) )
+	{ show_error( "--recover does not take a file argument.", 0, true, program_name, invocation_name );
+	  return 1; }
+      const char * const base = recover_journal( recover_name );
+      if( base == nullptr ) { return 1; }
+      if( base[0] != 0 && !set_def_filename( base ) ) { return 1; }
+      if( !open_journal( recover_name, nullptr, true ) ) { return 1; }
+    }
+
+  while( argind < ap_arguments( &parser ) || batch_file != nullptr )
+    {
+      const char * const arg = ( batch_file != nullptr ) ? batch_file :
+			       ap_argument( &parser, argind );
       auto arg_arr = span(arg, size_t(arg));
-      if( strcmp( arg, "-" ) == 0 ) { scripted(true, true); ++argind; continue; }
+      if( batch_file == nullptr && strcmp( arg, "-" ) == 0 )
+	{ scripted(true, true); ++argind; continue; }
       if( may_access_filename( arg ) )
 	{
-	  const int ret = read_file( arg, 0 );
+	  const int ret = read_file( arg, 0, true );
 	  if( ret < 0 && is_regular_file( 0 ) ) { return 2; }
 	  if( arg_arr[0] != '!' && !set_def_filename( arg ) ) { return 1; }
 	  if( ret == -2 ) { initial_error = true; }
+	  if( ret >= 0 ) { base_name = arg; }
 	}
       else
 	{
@@ -271,8 +617,14 @@ auto main( const int argc, const char * const argv[] ) -> int {
 	}
       break;
     }
+  if( journal_name != nullptr && recover_name == nullptr &&
+      !open_journal( journal_name, base_name, false ) ) { return 1; }
   ap_free( &parser );
 
   if( initial_error ) { fputs( "?\n", stdout ); }
-  return main_loop( initial_error, loose );
+  const int retval = main_loop( initial_error, loose );
+  close_journal();
+  if( stats() )
+    { print_command_stats( histogram ); print_sbuf_stats(); print_regex_stats(); }
+  return retval;
 }
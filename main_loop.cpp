@@ -23,6 +23,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <sys/resource.h>
 
 #include "ed.h"
 
@@ -97,10 +98,19 @@ static bool mark_line_node( const line_t * const lp, int c ) {
 }
 
 
-void unmark_line_node( const line_t * const lp ) {
+static void clear_marks( void ) {
+  for( int i = 0; i < 26; ++i ) {
+    mark[i] = nullptr;
+  }
+  markno = 0;
+}
+
+
+/* clear the marks of the lines that are not in the editor buffer */
+void unmark_deleted_nodes( void ) {
   int i;
   for( i = 0; markno != 0 && i < 26; ++i ) {
-    if( mark[i] == lp ) {
+    if( mark[i] != nullptr && !index_contains( mark[i] ) ) {
       mark[i] = nullptr;
       --markno;
     }
@@ -365,7 +375,7 @@ static int extract_addresses( const char ** const ibufpp ) {
 	    first_addr = second_addr;
 	  }
 	} else {
-	  if( second_addr < 0 || second_addr > last_addr() ) {
+	  if( second_addr < 0 || second_addr > last_addr_upto( second_addr ) ) {
 	    invalid_address();
 	    return -1;
 	  }
@@ -378,7 +388,8 @@ static int extract_addresses( const char ** const ibufpp ) {
 	++*ibufpp;
 	break;
       default :
-        if( !first && ( second_addr < 0 || second_addr > last_addr() ) ) {
+        if( !first && ( second_addr < 0 ||
+			second_addr > last_addr_upto( second_addr ) ) ) {
 	  invalid_address();
 	  return -1;
 	}
@@ -386,7 +397,9 @@ static int extract_addresses( const char ** const ibufpp ) {
 	if( second_addr >= 0 ) {
 	  addr_cnt = ( first_addr >= 0 ) ? 2 : 1;
 	}
-	if( addr_cnt <= 0 ) {
+	/* commands taking no address don't need the current address, which
+	   may not be known yet if the file is being indexed lazily */
+	if( addr_cnt <= 0 && strchr( "eEfhHPqQuU!#", **ibufpp ) == nullptr ) {
 	  second_addr = current_addr();
 	}
 	if( addr_cnt <= 1 ) {
@@ -412,7 +425,7 @@ static bool get_third_addr( const char ** const ibufpp, int * const addr ) {
     set_error_msg( "Destination expected" );
     return false;
   }
-  if( second_addr < 0 || second_addr > last_addr() ) {
+  if( second_addr < 0 || second_addr > last_addr_upto( second_addr ) ) {
     invalid_address();
     return false;
   }
@@ -422,13 +435,16 @@ static bool get_third_addr( const char ** const ibufpp, int * const addr ) {
 }
 
 
-/* set default range and return true if address range is valid */
+/* Set default range and return true if address range is valid.
+   The defaults are only computed if used by the callers below, so that
+   a file read lazily is indexed only as far as the addresses given. */
 static bool check_addr_range( const int n, const int m, const int addr_cnt ) {
   if( addr_cnt == 0 ) {
     first_addr = n;
     second_addr = m;
   }
-  if( first_addr < 1 || first_addr > second_addr || second_addr > last_addr() ) {
+  if( first_addr < 1 || first_addr > second_addr ||
+      second_addr > last_addr_upto( second_addr ) ) {
     invalid_address();
     return false;
   }
@@ -437,15 +453,22 @@ static bool check_addr_range( const int n, const int m, const int addr_cnt ) {
 
 /* set defaults to current_addr and return true if address range is valid */
 static bool check_addr_range2( const int addr_cnt ) {
-  return check_addr_range( current_addr(), current_addr(), addr_cnt );
+  const int addr = ( addr_cnt == 0 ) ? current_addr() : 0;
+  return check_addr_range( addr, addr, addr_cnt );
 }
 
-/* set default second_addr and return true if second_addr is valid */
-static bool check_second_addr( const int addr, const int addr_cnt ) {
+/* set defaults to 1,$ and return true if address range is valid */
+static bool check_addr_range_all( const int addr_cnt ) {
+  return check_addr_range( 1, ( addr_cnt == 0 ) ? last_addr() : 0, addr_cnt );
+}
+
+/* set default second_addr to current_addr + offset and return true if
+   second_addr is valid */
+static bool check_second_addr( const int offset, const int addr_cnt ) {
   if( addr_cnt == 0 ) {
-    second_addr = addr;
+    second_addr = current_addr() + offset;
   }
-  if( second_addr < 1 || second_addr > last_addr() ) {
+  if( second_addr < 1 || second_addr > last_addr_upto( second_addr ) ) {
     invalid_address();
     return false;
   }
@@ -560,6 +583,9 @@ static bool unexpected_command_suffix( const unsigned char ch ) {
 }
 
 
+static int last_subst_snum = 0;		/* of the last 's', for exec_global */
+static int last_subst_pflags = 0;
+
 static bool command_s( const char ** const ibufpp, int * const pflagsp,
                        const int addr_cnt, const bool isglobal ) {
   static int pflags = 0;	/* print suffixes */
@@ -666,7 +692,7 @@ static bool command_s( const char ** const ibufpp, int * const pflagsp,
       return false;
     }
   }
-  *pflagsp = pflags;
+  *pflagsp = last_subst_pflags = pflags; last_subst_snum = snum;
   if( !isglobal ) {
     clear_undo_stack();
   }
@@ -680,12 +706,130 @@ static bool command_s( const char ** const ibufpp, int * const pflagsp,
 static int exec_global( const char ** const ibufpp, const int pflags,
                         const bool interactive );
 
+/* Command statistics for --stats.
+   Each command is timed from the parsing of its addresses to its end, so
+   the time of 'g' and 'v' includes that of the commands they run, which
+   are counted too. Latencies are counted in buckets of powers of 2 of a
+   microsecond. The slowest commands read from stdin are kept with their
+   line number, so that a slow script can be traced to its source. */
+
+enum { hist_buckets = 32, slowest_max = 5, slow_text_max = 64 };
+
+struct Command_stats {
+  long count;
+  long long ns, max_ns;
+  long hist[hist_buckets];
+};
+
+struct Slow_command {
+  long long ns;
+  int line;
+  char text[slow_text_max];
+};
+
+static Command_stats command_stats[128];	/* indexed by command char */
+static Slow_command slowest[slowest_max];	/* slowest first */
+static int slowest_n = 0;
+static long top_count = 0;		/* commands read from stdin */
+static long long top_ns = 0;
+static int last_command = 0;		/* command char of last exec_command */
+
+
+static int exec_command( const char ** const ibufpp, const int prev_status,
+                         const bool isglobal );
+
+/* record the time taken by a command read from stdin line 'line' */
+static void record_command( const char * const text, const int line,
+                            const long long ns, const bool isglobal ) {
+  Command_stats & cs = command_stats[last_command & 127];
+  ++cs.count; cs.ns += ns;
+  if( ns > cs.max_ns ) { cs.max_ns = ns; }
+  int b = 0;
+  for( long long us = ns / 1000; us > 0 && b < hist_buckets - 1; us >>= 1 ) { ++b; }
+  ++cs.hist[b];
+  if( !isglobal ) { ++top_count; top_ns += ns; }
+  if( isglobal || ( slowest_n >= slowest_max && ns <= slowest[slowest_max-1].ns ) ) {
+    return;
+  }
+  int i = ( slowest_n < slowest_max ) ? slowest_n++ : slowest_max - 1;
+  for( ; i > 0 && slowest[i-1].ns < ns; --i ) { slowest[i] = slowest[i-1]; }
+  slowest[i].ns = ns; slowest[i].line = line;
+  snprintf( slowest[i].text, sizeof slowest[i].text, "%s", text );
+}
+
+
+/* like exec_command, timing the command if --stats */
+static int timed_command( const char ** const ibufpp, const int prev_status,
+                          const bool isglobal ) {
+  if( !stats() ) {
+    return exec_command( ibufpp, prev_status, isglobal );
+  }
+  char text[slow_text_max] = "";	/* the command may overwrite *ibufpp */
+  if( !isglobal ) {
+    const int len = strcspn( *ibufpp, "\n" );
+    snprintf( text, sizeof text, "%.*s", len, *ibufpp );
+  }
+  const int line = linenum();
+  const int outer = last_command;	/* of the 'g' running this command */
+  const long long t0 = monotonic_ns();
+  const int status = exec_command( ibufpp, prev_status, isglobal );
+  record_command( text, line, monotonic_ns() - t0, isglobal );
+  last_command = outer;
+  return status;
+}
+
+
+static const char * command_name( const int c ) {
+  static char buf[4];
+  if( c == '\n' ) { return "nl"; }
+  if( c <= ' ' || c >= 127 ) { return "?"; }
+  buf[0] = c; buf[1] = 0;
+  return buf;
+}
+
+
+/* print a latency as the upper bound of histogram bucket b */
+static void print_bucket( const int b ) {
+  const long long us = 1LL << b;
+  if( us < 1000 ) { fprintf( stderr, " <%lldus", us ); }
+  else if( us < 1000000 ) { fprintf( stderr, " <%.3gms", us / 1e3 ); }
+  else { fprintf( stderr, " <%.3gs", us / 1e6 ); }
+}
+
+
+void print_command_stats( const bool histogram ) {
+  struct rusage ru;
+  long count = 0;
+  for( const Command_stats & cs : command_stats ) { count += cs.count; }
+  const long rss = ( getrusage( RUSAGE_SELF, &ru ) == 0 ) ? ru.ru_maxrss : 0;
+  fprintf( stderr, "commands: %ld executed, %ld read from stdin in %.6f s, "
+           "peak RSS %ld KiB\n", count, top_count, top_ns / 1e9, rss );
+  for( int c = 0; c < 128; ++c ) {
+    const Command_stats & cs = command_stats[c];
+    if( cs.count == 0 ) { continue; }
+    fprintf( stderr, "  %-2s %9ld calls %12.6f s total %12.6f s max\n",
+             command_name( c ), cs.count, cs.ns / 1e9, cs.max_ns / 1e9 );
+    if( !histogram ) { continue; }
+    fputs( "    latency:", stderr );
+    for( int b = 0; b < hist_buckets; ++b ) {
+      if( cs.hist[b] ) { print_bucket( b ); fprintf( stderr, " %ld", cs.hist[b] ); }
+    }
+    fputc( '\n', stderr );
+  }
+  for( int i = 0; i < slowest_n; ++i ) {
+    fprintf( stderr, "  slowest: %.6f s, line %d: %s\n",
+             slowest[i].ns / 1e9, slowest[i].line, slowest[i].text );
+  }
+}
+
+
 /* execute the next command in command buffer; return error status */
 static int exec_command( const char ** const ibufpp, const int prev_status,
                          const bool isglobal ) {
   const char * fnp;				/* filename */
   int pflags = 0;				/* print suffixes */
   int addr, c, n;
+  last_command = 0;
   const int addr_cnt = extract_addresses( ibufpp );
 
   if( addr_cnt < 0 ) {
@@ -693,6 +837,7 @@ static int exec_command( const char ** const ibufpp, const int prev_status,
   }
   *ibufpp = skip_blanks( *ibufpp );
   c = *(*ibufpp)++;
+  last_command = c;
   switch( c ) {
   case 'a':
     if( !get_command_suffix( ibufpp, &pflags ) ) {
@@ -742,19 +887,44 @@ static int exec_command( const char ** const ibufpp, const int prev_status,
       return ERR;
     }
     fnp = get_filename( ibufpp, false );
-    if( fnp == nullptr || !delete_lines( 1, last_addr(), isglobal ) ||
-	!close_sbuf() ) {
+    if( fnp == nullptr ) {
+      return ERR;
+    }
+    pause_journal();
+    if( tail_reload() ) {		/* append only what was added */
+      const int ret = reload_file( ( fnp[0] != 0 ) ? fnp : def_filename );
+      if( ret < 0 ||
+          ( ret > 0 && fnp[0] != 0 && !set_def_filename( fnp ) ) ) {
+        checkpoint_journal( nullptr );
+        return ERR;
+      }
+      if( ret > 0 ) {
+        clear_marks();			/* as if the buffer were read again */
+        clear_yank_buffer();
+        checkpoint_journal( def_filename );
+        reset_undo_state();
+        set_modified( false );
+        break;
+      }
+    }
+    discard_lazy_lines();
+    if( !delete_lines( 1, last_addr(), isglobal ) || !close_sbuf() ) {
+      checkpoint_journal( nullptr );
       return ERR;
     }
     if( !open_sbuf() ) {
       return FATAL;
     }
     if( fnp[0] != 0 && fnp[0] != '!' && !set_def_filename( fnp ) ) {
+      checkpoint_journal( nullptr );
       return ERR;
     }
-    if( read_file( fnp[0] != 0 ? fnp : def_filename, 0 ) < 0 ) {
+    fnp = ( fnp[0] != 0 ) ? fnp : def_filename;
+    if( read_file( fnp, 0, true ) < 0 ) {
+      checkpoint_journal( nullptr );
       return ERR;
     }
+    checkpoint_journal( fnp );
     reset_undo_state();
     set_modified( false );
     break;
@@ -791,7 +961,7 @@ static int exec_command( const char ** const ibufpp, const int prev_status,
       return ERR;
     }
     n = static_cast<int> ( c == 'g' || c == 'G' );	/* mark matching lines */
-    if( !check_addr_range( 1, last_addr(), addr_cnt ) ||
+    if( !check_addr_range_all( addr_cnt ) ||
 	!build_active_list( ibufpp, first_addr, second_addr, n != 0 ) ) {
       return ERR;
     }
@@ -800,6 +970,7 @@ static int exec_command( const char ** const ibufpp, const int prev_status,
       return ERR;
     }
     n = exec_global( ibufpp, pflags, n != 0 );
+    clear_active_list();		/* while the deleted nodes are allocated */
     if( n != 0 ) {
       return n;
     }
@@ -829,7 +1000,8 @@ static int exec_command( const char ** const ibufpp, const int prev_status,
     }
     break;
   case 'j':
-    if( !check_addr_range( current_addr(), current_addr() + 1, addr_cnt ) ||
+    n = ( addr_cnt == 0 ) ? current_addr() : 0;
+    if( !check_addr_range( n, n + 1, addr_cnt ) ||
 	!get_command_suffix( ibufpp, &pflags ) ) {
       return ERR;
     }
@@ -952,6 +1124,17 @@ static int exec_command( const char ** const ibufpp, const int prev_status,
       return ERR;
     }
     break;
+  case 'U':
+    if( !multilevel_undo() ) {
+      set_error_msg( "Unknown command" );
+      return ERR;
+    }
+    if( unexpected_address( addr_cnt ) ||
+	!get_command_suffix( ibufpp, &pflags ) ||
+	!redo( isglobal ) ) {
+      return ERR;
+    }
+    break;
   case 'w':
   case 'W':
     n = **ibufpp;
@@ -967,7 +1150,7 @@ static int exec_command( const char ** const ibufpp, const int prev_status,
     }
     if( addr_cnt == 0 && last_addr() == 0 ) {
       first_addr = second_addr = 0;
-    } else if( !check_addr_range( 1, last_addr(), addr_cnt ) ) {
+    } else if( !check_addr_range_all( addr_cnt ) ) {
       return ERR;
     }
     if( def_filename[0] == 0 && fnp[0] != '!' && !set_def_filename( fnp ) ) {
@@ -978,6 +1161,12 @@ static int exec_command( const char ** const ibufpp, const int prev_status,
     if( addr < 0 ) {
       return ERR;
     }
+    if( addr == last_addr() && fnp[0] != '!' &&
+        c == 'w' && ( first_addr == 1 || addr == 0 ) ) {
+      checkpoint_journal( fnp[0] != 0 ? fnp : def_filename );
+    } else if( !journal_base_intact() ) {
+      checkpoint_journal( nullptr );	/* part of the buffer went to the base */
+    }
     if( addr == last_addr() && fnp[0] != '!' ) {
       set_modified( false );
     } else if( n == 'q' && modified() && prev_status != EMOD ) {
@@ -988,7 +1177,7 @@ static int exec_command( const char ** const ibufpp, const int prev_status,
     }
     break;
   case 'x':
-    if( second_addr < 0 || second_addr > last_addr() ) {
+    if( second_addr < 0 || second_addr > last_addr_upto( second_addr ) ) {
       invalid_address();
       return ERR;
     }
@@ -1010,7 +1199,7 @@ static int exec_command( const char ** const ibufpp, const int prev_status,
     }
     break;
   case 'z':
-    if( !check_second_addr( current_addr() + static_cast<int> ( !isglobal ), addr_cnt ) ) {
+    if( !check_second_addr( static_cast<int> ( !isglobal ), addr_cnt ) ) {
       return ERR;
     }
     if( **ibufpp > '0' && **ibufpp <= '9' ) {
@@ -1022,7 +1211,8 @@ static int exec_command( const char ** const ibufpp, const int prev_status,
     }
     if( !get_command_suffix( ibufpp, &pflags ) ||
 	!print_lines( second_addr,
-		      min( last_addr(), second_addr + window_lines() - 1 ),
+		      min( last_addr_upto( second_addr + window_lines() - 1 ),
+			   second_addr + window_lines() - 1 ),
 		      pflags ) ) {
       return ERR;
     }
@@ -1042,6 +1232,7 @@ static int exec_command( const char ** const ibufpp, const int prev_status,
     if( fnp == nullptr ) {
       return ERR;
     }
+    sync_stdin();
     if( system( fnp + 1 ) < 0 ) {
       set_error_msg( "Can't create shell process" );
       return ERR;
@@ -1050,9 +1241,23 @@ static int exec_command( const char ** const ibufpp, const int prev_status,
       fputs( "!\n", stdout );
     }
     break;
+  case '|':
+    if( !check_addr_range2( addr_cnt ) ) {
+      return ERR;
+    }
+    fnp = get_shell_command( ibufpp );
+    if( fnp == nullptr ) {
+      return ERR;
+    }
+    if( !isglobal ) {
+      clear_undo_stack();
+    }
+    if( !filter_lines( fnp + 1, first_addr, second_addr, isglobal ) ) {
+      return ERR;
+    }
+    break;
   case '\n':
-    if( !check_second_addr( current_addr() +
-			    static_cast<int> ( traditional() || !isglobal ), addr_cnt ) ||
+    if( !check_second_addr( static_cast<int> ( traditional() || !isglobal ), addr_cnt ) ||
 	!print_lines( second_addr, second_addr, 0 ) ) {
       return ERR;
     }
@@ -1071,13 +1276,49 @@ static int exec_command( const char ** const ibufpp, const int prev_status,
 }
 
 
+/* Run the substitution just parsed by exec_global on the rest of the
+   active lines, on each run of consecutive lines at once. Return the
+   status of exec_global. */
+static int subst_active_runs( void ) {
+  const line_t * lp = next_active_node();
+  while( lp != nullptr ) {
+    const line_t * last = lp;
+    const line_t * np;
+    int n = 1;
+    while( ( np = next_active_node() ) != nullptr && np == last->q_forw ) {
+      last = np; ++n;
+    }
+    const int from = get_line_node_addr( lp );
+    if( from < 0 ) {
+      return ERR;
+    }
+    const int o_last_addr = last_addr();
+    int error_addr = from;
+    if( !search_and_replace( from, from + n - 1, last_subst_snum, true,
+                             &error_addr ) ) {
+      set_current_addr( error_addr );	/* as if done line by line */
+      return ERR;
+    }
+    /* the last line of the run, or the last line of its new text */
+    set_current_addr( from + n - 1 + last_addr() - o_last_addr );
+    lp = np;
+  }
+  return 0;
+}
+
+
 /* Apply command list in the command buffer to the active lines in a range.
-   Stop at first error. Return status of last command executed. */
+   Stop at first error. Return status of last command executed.
+   A list consisting of only a substitution with a pattern, and without
+   print suffixes, is parsed once; the substitution is then done on runs
+   of consecutive lines, as by 's' on a range. The result is the same as
+   executing it on each line. */
 static int exec_global( const char ** const ibufpp, const int pflags,
                         const bool interactive ) {
   static char * buf = nullptr;
   static int bufsz = 0;
   const char * cmd = nullptr;
+  bool subst_list = false;		/* cmd may be a single substitution */
 
   if( !interactive ) {
     if( traditional() && strcmp( *ibufpp, "\n" ) == 0 ) {
@@ -1087,6 +1328,8 @@ static int exec_global( const char ** const ibufpp, const int pflags,
 	return ERR;
       }
       cmd = *ibufpp;
+      subst_list = ( cmd[0] == 's' && cmd[1] != 0 &&
+                     strchr( "\n123456789gpr", cmd[1] ) == nullptr );
     }
   }
   clear_undo_stack();
@@ -1131,10 +1374,14 @@ static int exec_global( const char ** const ibufpp, const int pflags,
     }
     *ibufpp = cmd;
     while( **ibufpp != 0 ) {
-      const int status = exec_command( ibufpp, 0, true );
+      const int status = timed_command( ibufpp, 0, true );
       if( status != 0 ) {
 	return status;
       }
+      if( subst_list && **ibufpp == 0 && last_subst_pflags == 0 ) {
+        return subst_active_runs();
+      }
+      subst_list = false;
     }
   }
   return 0;
@@ -1165,12 +1412,15 @@ int main_loop( const bool initial_error, const bool loose ) {
     }
   } else {
     status = -1;
+    clear_active_list();
     fputs( "\n?\n", stdout );
     set_error_msg( "Interrupt" );
   }
 
   while( true ) {
     fflush( stdout ); fflush( stderr );
+    compact_sbuf();			/* idle point */
+    flush_journal();
     if( status < 0 && verbose ) {
       printf( "%s\n", errmsg );
       fflush( stdout );
@@ -1193,7 +1443,7 @@ int main_loop( const bool initial_error, const bool loose ) {
 	}
       }
     } else {
-      status = exec_command( &ibufp, status, false );
+      status = timed_command( &ibufp, status, false );
     }
     if( status == 0 ) {
       continue;
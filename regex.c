@@ -19,10 +19,16 @@
 
 #include <stddef.h>
 #include <errno.h>
+#include <langinfo.h>
+#include <limits.h>
+#include <locale.h>
+#include <pthread.h>
 #include <regex.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <signal.h>
+#include <unistd.h>
 
 #include "ed.h"
 
@@ -110,34 +116,433 @@ static char * extract_pattern( const char ** const ibufpp, const char delimiter
   }
 
 
-/* Return pointer to compiled regex (last_regexp), different from subst_regexp.
+typedef struct			/* compiled regex cached by compile_regex */
+  {
+  char * pat;			/* pattern, or 0 if the entry is free */
+  int cflags;
+  unsigned long used;		/* time of last use */
+  char * lit;			/* literal contained in every match, or 0 */
+  int llen;			/* length of lit */
+  bool bol, eol;		/* lit is anchored at begin/end of line */
+  bool pure;			/* the regex matches just lit */
+  bool lit_nl;			/* lit contains a newline ( a NUL in text ) */
+  int bytes;			/* bexp: 1 compiled, 0 not yet, -1 not usable */
+  regex_t exp;
+  regex_t bexp;			/* exp compiled in the C locale */
+  }
+regcache_t;
+
+static regcache_t * rcache = 0;		/* cache of compiled regexes */
+static int rcache_size = 64;		/* max number of entries */
+static int rcache_n = 0;		/* number of entries in use */
+static unsigned long rcache_clock = 0;
+static long rcache_hits = 0;
+static long rcache_misses = 0;
+static long rx_compiles = 0;		/* calls to regcomp */
+static long long rx_compile_ns = 0;
+static long rx_bytes = 0;		/* compilations in the C locale */
+static enum Matcher matcher = rm_auto;
+static locale_t c_locale = 0;		/* for compilations in the C locale */
+static long rx_execs = 0;		/* calls to regexec, from any thread */
+static long long rx_exec_ns = 0;	/* time in regexec, summed over threads */
+static long rx_mt_lines = 0;		/* lines matched by worker threads */
+
+
+/* like regcomp, timing the compilation for --stats */
+static int timed_regcomp( regex_t * const exp, const char * const pat,
+                          const int cflags )
+  {
+  const long long t0 = stats() ? monotonic_ns() : 0;
+  const int n = regcomp( exp, pat, cflags );
+  if( t0 ) { ++rx_compiles; rx_compile_ns += monotonic_ns() - t0; }
+  return n;
+  }
+
+
+/* Like timed_regcomp, in the C locale if 'bytes'. The regex then
+   matches the text byte by byte, which is much faster than matching it
+   in a multibyte locale. */
+static int compile_in( regex_t * const exp, const char * const pat,
+                       const int cflags, const bool bytes )
+  {
+  if( !bytes ) return timed_regcomp( exp, pat, cflags );
+  if( !c_locale ) c_locale = newlocale( LC_ALL_MASK, "C", (locale_t)0 );
+  if( !c_locale ) return REG_ESPACE;
+  const locale_t old = uselocale( c_locale );
+  const int n = timed_regcomp( exp, pat, cflags );
+  uselocale( old );
+  if( n == 0 ) ++rx_bytes;
+  return n;
+  }
+
+
+/* set the size of the regex cache; to be called before any regex use */
+void set_regex_cache_size( const int size )
+  { rcache_size = max( size, 3 ); }
+
+void set_regex_matcher( const enum Matcher m ) { matcher = m; }
+
+
+void print_regex_stats( void )
+  {
+  fprintf( stderr, "regex cache: %ld hits, %ld misses, %d entries\n",
+           rcache_hits, rcache_misses, rcache_n );
+  fprintf( stderr, "regex: %ld compiled in %.6f s, %ld executed in %.6f s\n",
+           rx_compiles, rx_compile_ns / 1e9, rx_execs, rx_exec_ns / 1e9 );
+  fprintf( stderr, "regex: %ld compiled for single-byte matching\n",
+           rx_bytes );
+  fprintf( stderr, "regex: %ld lines matched in worker threads\n",
+           rx_mt_lines );
+  }
+
+
+/* Skip a parenthesized group of 'pat' starting after its '(' or '\('.
+   Return a pointer to the closing ')' or '\)', or 0 if unbalanced. */
+static const char * skip_group( const char * p, const bool ere )
+  {
+  int depth = 1;
+
+  for( ; *p; ++p )
+    {
+    if( *p == '[' ) { p = parse_char_class( p + 1 ); if( !p ) return 0; }
+    else if( *p == '\\' )
+      {
+      if( !*++p ) return 0;
+      if( !ere && *p == '(' ) ++depth;
+      else if( !ere && *p == ')' && --depth == 0 ) return p;
+      }
+    else if( ere && *p == '(' ) ++depth;
+    else if( ere && *p == ')' && --depth == 0 ) return p;
+    }
+  return 0;
+  }
+
+
+/* Find in the pattern of 'rp' the longest literal string that every match
+   must contain, and set 'pure' if the pattern is just that literal,
+   optionally anchored. Groups, classes and repeated atoms just end the
+   current literal. The analysis gives up if the pattern has alternations
+   outside of groups, or if matching the text byte by byte is not the same
+   as matching it by characters ( case folding, or a multibyte encoding
+   other than UTF-8 ). */
+static void analyze_regex( regcache_t * const rp )
+  {
+  const bool ere = rp->cflags & REG_EXTENDED;
+  const bool utf8 = ( MB_CUR_MAX > 1 );
+  const char * p = rp->pat;
+  char * const run = (char *) malloc( strlen( p ) + 1 );
+  int n = 0, blen = 0;
+  bool ok = true, pure = true, run_bol = false;
+
+  rp->lit = 0; rp->llen = 0;
+  rp->bol = rp->eol = rp->pure = rp->lit_nl = false;
+  if( !run || ( rp->cflags & REG_ICASE ) ||
+      ( utf8 && strcmp( nl_langinfo( CODESET ), "UTF-8" ) != 0 ) )
+    { free( run ); return; }
+  if( *p == '^' ) { run_bol = true; ++p; }
+  while( ok && *p && ( *p != '$' || p[1] ) )
+    {
+    const char c = *p++;
+    bool lit = false, repeat = false;	/* literal; previous atom repeated */
+    if( c == '\\' )
+      {
+      const char d = *p;
+      if( d && strchr( ere ? ".[]\\*+?{}()|^$/" : ".[]\\*^$/", d ) )
+        lit = true;
+      else if( !d || ( !ere && d == '|' ) ) ok = false;
+      else if( !ere && d == '(' )
+        { p = skip_group( p + 1, false ); if( p ) ++p; else ok = false; }
+      else if( !ere && d == '{' )
+        { p = strstr( p, "\\}" ); if( p ) p += 2; else ok = false;
+          repeat = true; }
+      else { repeat = ( !ere && ( d == '+' || d == '?' ) ); ++p; }
+      }
+    else if( c == '[' )
+      { p = parse_char_class( p ); if( p ) ++p; else ok = false; }
+    else if( c == '*' || ( ere && ( c == '+' || c == '?' ) ) ) repeat = true;
+    else if( ere && c == '{' )
+      { p = strchr( p, '}' ); if( p ) ++p; else ok = false; repeat = true; }
+    else if( ere && c == '(' )
+      { p = skip_group( p, true ); if( p ) ++p; else ok = false; }
+    else if( ere && ( c == '|' || c == ')' ) ) ok = false;
+    else if( c != '.' && c != '^' && c != '$' ) { run[n++] = c; continue; }
+    if( lit ) { run[n++] = *p++; continue; }
+    pure = false;
+    if( repeat && n > 0 )		/* drop the repeated character */
+      { if( utf8 ) while( n > 1 && ( run[n-1] & 0xC0 ) == 0x80 ) --n;
+        --n; }
+    if( n > blen )			/* keep the longest literal */
+      {
+      free( rp->lit ); rp->lit = (char *) malloc( n );
+      if( !rp->lit ) { ok = false; break; }
+      memcpy( rp->lit, run, n ); rp->llen = blen = n; rp->bol = run_bol;
+      }
+    n = 0; run_bol = false;
+    }
+  if( ok && ( pure || n > blen ) )	/* the last literal */
+    {
+    free( rp->lit ); rp->lit = (char *) malloc( n + 1 );
+    if( rp->lit )
+      {
+      memcpy( rp->lit, run, n ); rp->llen = n;
+      rp->bol = run_bol; rp->eol = ( *p == '$' ); rp->pure = pure;
+      if( utf8 ) for( int i = 0; i < n; ++i )	/* only ASCII is pure */
+        if( run[i] & 0x80 ) { rp->pure = false; break; }
+      }
+    }
+  if( !ok || ( !rp->pure && rp->llen == 0 ) )
+    { free( rp->lit ); rp->lit = 0; rp->llen = 0;
+      rp->bol = rp->eol = rp->pure = false; }
+  rp->lit_nl = ( rp->lit && memchr( rp->lit, '\n', rp->llen ) );
+  free( run );
+  }
+
+
+/* Return true if the pattern 'pat' matches any ASCII text compiled in the
+   C locale exactly as compiled in the current locale. This requires an
+   ASCII pattern, and, unless the collation of the locale is in code point
+   order, no ranges or collating elements in its bracket expressions. */
+static bool bytes_equivalent( const char * p )
+  {
+  const char * const coll = setlocale( LC_COLLATE, 0 );
+  const bool cp_order = coll && ( strcmp( coll, "POSIX" ) == 0 ||
+                        ( coll[0] == 'C' && ( !coll[1] || coll[1] == '.' ) ) );
+
+  for( ; *p; ++p )
+    {
+    if( *p & 0x80 ) return false;
+    if( *p == '\\' ) { if( !*++p ) break; if( *p & 0x80 ) return false; }
+    else if( *p == '[' )
+      {
+      const char * const end = parse_char_class( p + 1 );
+      if( !end ) return false;
+      const char * q = p + 1;
+      if( *q == '^' ) ++q;
+      if( *q == ']' ) ++q;
+      for( const char * const first = q; q < end; ++q )
+        {
+        if( *q & 0x80 ) return false;
+        if( *q == '[' && ( q[1] == '=' || q[1] == '.' ) ) return false;
+        if( *q == '[' && q[1] == ':' )		/* skip the class name */
+          { q = strstr( q + 2, ":]" ); if( !q ) return false; ++q; }
+        else if( *q == '-' && q > first && q + 1 < end && !cp_order )
+          return false;
+        }
+      p = end;
+      }
+    }
+  return true;
+  }
+
+
+/* Return the compiled form of 'exp' to match the text of the buffer.
+   On a multibyte locale, an ASCII pattern is matched byte by byte while
+   the buffer contains only ASCII text, as the result is the same. The
+   buffer is checked on each call because lines read lazily may add
+   non-ASCII text to it in the middle of a search. */
+static const regex_t * text_regex( const regex_t * const exp )
+  {
+  regcache_t * const rp = (regcache_t *)
+    ( (char *)exp - offsetof( regcache_t, exp ) );
+
+  if( matcher == rm_locale || ( matcher == rm_auto && nonascii() ) )
+    return exp;
+  if( rp->bytes == 0 )
+    {
+    const bool ok = ( matcher == rm_bytes ) ? MB_CUR_MAX > 1 :
+                    MB_CUR_MAX > 1 && bytes_equivalent( rp->pat );
+    rp->bytes = ( ok && compile_in( &rp->bexp, rp->pat, rp->cflags, true ) == 0 ) ?
+                1 : -1;
+    }
+  return ( rp->bytes > 0 ) ? &rp->bexp : exp;
+  }
+
+
+/* Return pointer to compiled regex (last_regexp).
+   Regexes are cached, keyed on their pattern and flags, and are never
+   freed while they are last_regexp or subst_regexp.
    Return 0 if error.
 */
 static regex_t * compile_regex( const char * const pat, const bool ignore_case )
   {
-  static regex_t store[3];		/* space for three compiled regexes */
-  regex_t * exp;
-  int n;
-
-  for( n = 0; n < 3; ++n )
-    if( ( exp = &store[n] ) != last_regexp && exp != subst_regexp ) break;
   const int cflags = ( extended_regexp() ? REG_EXTENDED : 0 ) |
                      ( ignore_case ? REG_ICASE : 0 );
-  n = regcomp( exp, pat, cflags );
+  regcache_t * rp = 0;
+  int i, n;
+
+  for( i = 0; i < rcache_n; ++i )
+    if( rcache[i].pat && rcache[i].cflags == cflags &&
+        strcmp( rcache[i].pat, pat ) == 0 )
+      {
+      ++rcache_hits; rcache[i].used = ++rcache_clock;
+      last_regexp = &rcache[i].exp;
+      return last_regexp;
+      }
+  ++rcache_misses;
+  if( !rcache )
+    {
+    rcache = (regcache_t *) malloc( rcache_size * sizeof (regcache_t) );
+    if( !rcache ) { set_error_msg( mem_msg ); return 0; }
+    }
+  for( i = 0; i < rcache_n; ++i )	/* a free entry, or the LRU one */
+    {
+    regcache_t * const p = &rcache[i];
+    if( &p->exp == last_regexp || &p->exp == subst_regexp ) continue;
+    if( !p->pat ) { rp = p; break; }
+    if( !rp || p->used < rp->used ) rp = p;
+    }
+  if( ( !rp || rp->pat ) && rcache_n < rcache_size )
+    { rp = &rcache[rcache_n++]; rp->pat = 0; }
+  if( rp->pat )
+    { regfree( &rp->exp ); free( rp->pat ); free( rp->lit ); rp->pat = 0;
+      if( rp->bytes > 0 ) regfree( &rp->bexp ); }
+  char * const p = (char *) malloc( strlen( pat ) + 1 );
+  if( !p ) { set_error_msg( mem_msg ); return 0; }
+  n = timed_regcomp( &rp->exp, pat, cflags );
   if( n )
     {
     char buf[80];
-    regerror( n, last_regexp, buf, sizeof buf );
+    regerror( n, &rp->exp, buf, sizeof buf );
     set_error_msg( buf );
+    free( p );
     return 0;
     }
-  /* free last_regexp if compiled and different from subst_regexp */
-  if( last_regexp && last_regexp != subst_regexp ) regfree( last_regexp );
-  last_regexp = exp;
+  rp->pat = strcpy( p, pat ); rp->cflags = cflags; rp->bytes = 0;
+  rp->used = ++rcache_clock;
+  analyze_regex( rp );
+  last_regexp = &rp->exp;
   return last_regexp;
   }
 
 
+/* return the cache entry of a compiled regex */
+static const regcache_t * regex_entry( const regex_t * const exp )
+  { return (const regcache_t *)
+           ( (const char *)exp - offsetof( regcache_t, exp ) ); }
+
+
+/* Return the offset of the first occurrence of the literal of 'rp' in a
+   text of 'len' bytes, honoring its anchors, or -1 if not found. */
+static long find_literal( const regcache_t * const rp, const char * const s,
+                          const long len, const bool notbol )
+  {
+  const int ll = rp->llen;
+
+  if( len < ll || ( rp->bol && notbol ) ) return -1;
+  if( rp->bol )
+    return ( ( !rp->eol || len == ll ) && memcmp( s, rp->lit, ll ) == 0 ) ?
+           0 : -1;
+  if( rp->eol )
+    return ( memcmp( s + len - ll, rp->lit, ll ) == 0 ) ? len - ll : -1;
+  const char * const p = (const char *) memmem( s, len, rp->lit, ll );
+  return p ? p - s : -1;
+  }
+
+
+#ifdef REG_STARTEND
+static const bool have_startend = true;
+#else
+static const bool have_startend = false;
+#endif
+
+/* Like regexec, for a string of 'len' bytes. With REG_STARTEND the string
+   needs not be followed by a NUL, else s[len] must be a NUL.
+   Thread-safe; the counters are updated atomically. */
+static int regexec_len( const regex_t * const exp, const char * const s,
+                        const long len, const size_t nmatch,
+                        regmatch_t pmatch[], const int eflags )
+  {
+  const long long t0 = stats() ? monotonic_ns() : 0;
+#ifdef REG_STARTEND
+  regmatch_t rm;
+  regmatch_t * const pm = nmatch ? pmatch : &rm;
+  pm[0].rm_so = 0; pm[0].rm_eo = len;
+  const int n = regexec( exp, s, nmatch, pm, eflags | REG_STARTEND );
+#else
+  const int n = regexec( exp, s, nmatch, pmatch, eflags );
+#endif
+  if( t0 )
+    { __atomic_fetch_add( &rx_execs, 1, __ATOMIC_RELAXED );
+      __atomic_fetch_add( &rx_exec_ns, monotonic_ns() - t0, __ATOMIC_RELAXED ); }
+  return n;
+  }
+
+
+/* Like regexec_len. Strings not containing the
+   literal of the regex are rejected without calling regexec, and pure
+   literals are matched without calling it at all. */
+static int match_regex( const regcache_t * const rp, const regex_t * const exp,
+                        const char * const s, const long len,
+                        const size_t nmatch, regmatch_t pmatch[],
+                        const int eflags )
+  {
+  if( rp->lit )
+    {
+    const long i = find_literal( rp, s, len, eflags & REG_NOTBOL );
+    if( i < 0 ) return REG_NOMATCH;
+    if( rp->pure )
+      {
+      for( size_t j = 0; j < nmatch; ++j )
+        pmatch[j].rm_so = pmatch[j].rm_eo = -1;
+      if( nmatch > 0 ) { pmatch[0].rm_so = i; pmatch[0].rm_eo = i + rp->llen; }
+      return 0;
+      }
+    }
+  return regexec_len( exp, s, len, nmatch, pmatch, eflags );
+  }
+
+
+/* The text of a line as stored in the buffer ( raw text ) is matched in
+   place, without copying it, unless it contains NULs. Regexes see NULs as
+   newlines, so in that case the text is copied and translated first. */
+
+/* Look for the literal of a regex in the raw text of a line.
+   Return 0 if the line can't match, 1 if it may match, 2 if it matches. */
+static int prefilter_text( const regcache_t * const rp, const char * const s,
+                           const int len )
+  {
+  if( !rp->lit || rp->lit_nl ) return 1;
+  return ( find_literal( rp, s, len, false ) < 0 ) ? 0 : rp->pure ? 2 : 1;
+  }
+
+
+/* return true if the raw text of a line can be matched in place */
+static bool raw_matchable( const char * const s, const int len )
+  { return have_startend && ( !isbinary() || !memchr( s, 0, len ) ); }
+
+
+/* Return 1 if the raw text of a line matches a regex, 0 if not, or -1 if
+   the text must be copied and translated first. */
+static int match_raw_text( const regcache_t * const rp,
+                           const regex_t * const exp,
+                           const char * const s, const int len )
+  {
+  const int m = prefilter_text( rp, s, len );
+
+  if( m != 1 ) return m / 2;
+  if( !raw_matchable( s, len ) ) return -1;
+  return !regexec_len( exp, s, len, 0, 0, 0 );
+  }
+
+
+/* Return 1 if a line matches a regex, 0 if not, -1 if error. */
+static int line_matches( const regex_t * const re, const line_t * const lp )
+  {
+  const regcache_t * const rp = regex_entry( re );
+  const regex_t * const exp = text_regex( re );
+
+  disable_interrupts();
+  const char * const t = get_sbuf_text( lp );
+  const int m = t ? match_raw_text( rp, exp, t, lp->len ) : -1;
+  enable_interrupts();
+  if( m >= 0 || !t ) return m;
+  char * const s = get_sbuf_line( lp );
+  if( !s ) return -1;
+  if( isbinary() ) nul_to_newline( s, lp->len );
+  return !match_regex( rp, exp, s, lp->len, 0, 0, 0 );
+  }
+
+
 /* return pointer to compiled regex from command buffer, or to previous
    compiled regex if empty RE. return 0 if error */
 static regex_t * get_compiled_regex( const char ** const ibufpp )
@@ -193,11 +598,7 @@ bool set_subst_regex( const char * const pat, const bool ignore_case )
 
   disable_interrupts();
   regex_t * exp = *pat ? compile_regex( pat, ignore_case ) : last_regexp;
-  if( exp && exp != subst_regexp )
-    {
-    if( subst_regexp ) regfree( subst_regexp );
-    subst_regexp = exp;
-    }
+  if( exp ) subst_regexp = exp;
   enable_interrupts();
   return ( exp ? true : false );
   }
@@ -207,35 +608,7 @@ bool set_subst_regex( const char * const pat, const bool ignore_case )
 bool replace_subst_re_by_search_re( void )
   {
   if( !last_regexp ) { set_error_msg( no_prev_pat ); return false; }
-  if( last_regexp != subst_regexp )
-    {
-    disable_interrupts();
-    if( subst_regexp ) regfree( subst_regexp );
-    subst_regexp = last_regexp;
-    enable_interrupts();
-    }
-  return true;
-  }
-
-
-/* add lines matching a regular expression to the global-active list */
-bool build_active_list( const char ** const ibufpp, const int first_addr,
-                        const int second_addr, const bool match )
-  {
-  int addr;
-
-  const regex_t * const exp = get_compiled_regex( ibufpp );
-  if( !exp ) return false;
-  clear_active_list();
-  const line_t * lp = search_line_node( first_addr );
-  for( addr = first_addr; addr <= second_addr; ++addr, lp = lp->q_forw )
-    {
-    char * const s = get_sbuf_line( lp );
-    if( !s ) return false;
-    if( isbinary() ) nul_to_newline( s, lp->len );
-    if( match == !regexec( exp, s, 0, 0, 0 ) && !set_active_node( lp ) )
-      return false;
-    }
+  subst_regexp = last_regexp;
   return true;
   }
 
@@ -253,11 +626,9 @@ int next_matching_node_addr( const char ** const ibufpp )
     addr = ( forward ? inc_addr( addr ) : dec_addr( addr ) );
     if( addr )
       {
-      const line_t * const lp = search_line_node( addr );
-      char * const s = get_sbuf_line( lp );
-      if( !s ) return -1;
-      if( isbinary() ) nul_to_newline( s, lp->len );
-      if( !regexec( exp, s, 0, 0, 0 ) ) return addr;
+      const int m = line_matches( exp, search_line_node( addr ) );
+      if( m < 0 ) return -1;
+      if( m ) return addr;
       }
     }
   while( addr != current_addr() );
@@ -310,12 +681,27 @@ bool extract_replacement( const char ** const ibufpp, const bool isglobal )
   }
 
 
+typedef bool (* resize_fn)( char ** const buf, int * const size,
+                            const unsigned min_size );
+
+
+/* Copy n bytes of line text. If 'nuls', the text was translated for the
+   regex, and its newlines are translated back to NULs. */
+static void copy_text( char * const to, const char * const from,
+                       const int n, const bool nuls )
+  {
+  memcpy( to, from, n );
+  if( nuls ) newline_to_nul( to, n );
+  }
+
+
 /* Produce replacement text from matched text and replacement template.
    Return new offset to end of replacement text, or -1 if error. */
 static int replace_matched_text( char ** txtbufp, int * const txtbufszp,
                                  const char * const txt,
                                  const regmatch_t * const rm, int offset,
-                                 const int re_nsub )
+                                 const int re_nsub, const bool nuls,
+                                 const resize_fn resize )
   {
   int i;
 
@@ -325,45 +711,46 @@ static int replace_matched_text( char ** txtbufp, int * const txtbufszp,
     if( rbuf[i] == '&' )
       {
       int j = rm[0].rm_so; int k = rm[0].rm_eo;
-      if( !resize_buffer( txtbufp, txtbufszp, offset - j + k ) ) return -1;
-      while( j < k ) (*txtbufp)[offset++] = txt[j++];
+      if( !resize( txtbufp, txtbufszp, offset - j + k ) ) return -1;
+      copy_text( *txtbufp + offset, txt + j, k - j, nuls ); offset += k - j;
       }
     else if( rbuf[i] == '\\' && rbuf[++i] >= '1' && rbuf[i] <= '9' &&
              ( n = rbuf[i] - '0' ) <= re_nsub )
       {
       int j = rm[n].rm_so; int k = rm[n].rm_eo;
-      if( !resize_buffer( txtbufp, txtbufszp, offset - j + k ) ) return -1;
-      while( j < k ) (*txtbufp)[offset++] = txt[j++];
+      if( !resize( txtbufp, txtbufszp, offset - j + k ) ) return -1;
+      copy_text( *txtbufp + offset, txt + j, k - j, nuls ); offset += k - j;
       }
     else		/* preceding 'if' skipped escaping backslashes */
       {
-      if( !resize_buffer( txtbufp, txtbufszp, offset + 1 ) ) return -1;
+      if( !resize( txtbufp, txtbufszp, offset + 1 ) ) return -1;
       (*txtbufp)[offset++] = rbuf[i];
       }
     }
-  if( !resize_buffer( txtbufp, txtbufszp, offset + 1 ) ) return -1;
+  if( !resize( txtbufp, txtbufszp, offset + 1 ) ) return -1;
   (*txtbufp)[offset] = 0;
   return offset;
   }
 
 
-/* Produce new text with one or all matches replaced in a line.
-   Return size of the new line text, 0 if no change, -1 if error */
-static int line_replace( char ** txtbufp, int * const txtbufszp,
-                         const line_t * const lp, const int snum )
+/* Produce at 'offset' in *txtbufp the new text of a line of 'len' bytes,
+   with one or all matches replaced. Return the offset to the end of the
+   new text, 0 if no change, or -1 if error. Errors not reported by
+   'resize' are returned in *errp. 'nuls' is as in copy_text. */
+static int replace_text( char ** txtbufp, int * const txtbufszp, int offset,
+                         const char * txt, const int len,
+                         const regcache_t * const rp, const regex_t * const exp,
+                         const int snum, const bool nuls,
+                         const resize_fn resize, const char ** const errp )
   {
   enum { se_max = 30 };	/* max subexpressions in a regular expression */
   regmatch_t rm[se_max];
-  char * txt = get_sbuf_line( lp );
-  const char * eot;
-  int i = 0, offset = 0;
+  const char * const eot = txt + len;
+  int i = 0;
   const bool global = ( snum <= 0 );
   bool changed = false;
 
-  if( !txt ) return -1;
-  if( isbinary() ) nul_to_newline( txt, lp->len );
-  eot = txt + lp->len;
-  if( !regexec( subst_regexp, txt, se_max, rm, 0 ) )
+  if( !match_regex( rp, exp, txt, len, se_max, rm, 0 ) )
     {
     int matchno = 0;
     bool infloop = false;
@@ -371,79 +758,421 @@ static int line_replace( char ** txtbufp, int * const txtbufszp,
       if( global || snum == ++matchno )
         {
         changed = true; i = rm[0].rm_so;
-        if( !resize_buffer( txtbufp, txtbufszp, offset + i ) ) return -1;
-        if( isbinary() ) newline_to_nul( txt, rm[0].rm_eo );
-        memcpy( *txtbufp + offset, txt, i ); offset += i;
+        if( !resize( txtbufp, txtbufszp, offset + i ) ) return -1;
+        copy_text( *txtbufp + offset, txt, i, nuls ); offset += i;
         offset = replace_matched_text( txtbufp, txtbufszp, txt, rm, offset,
-                                       subst_regexp->re_nsub );
+                                       exp->re_nsub, nuls, resize );
         if( offset < 0 ) return -1;
         }
       else
         {
         i = rm[0].rm_eo;
-        if( !resize_buffer( txtbufp, txtbufszp, offset + i ) ) return -1;
-        if( isbinary() ) newline_to_nul( txt, i );
-        memcpy( *txtbufp + offset, txt, i ); offset += i;
+        if( !resize( txtbufp, txtbufszp, offset + i ) ) return -1;
+        copy_text( *txtbufp + offset, txt, i, nuls ); offset += i;
         }
       txt += rm[0].rm_eo;
       if( global && rm[0].rm_eo == 0 )
         { if( !infloop ) infloop = true;	/* 's/^/#/g' is valid */
-          else { set_error_msg( "Infinite substitution loop" ); return -1; } }
+          else { *errp = "Infinite substitution loop"; return -1; } }
       }
-    while( *txt && ( !changed || global ) &&
-           !regexec( subst_regexp, txt, se_max, rm, REG_NOTBOL ) );
+    while( txt < eot && ( !changed || global ) &&
+           !match_regex( rp, exp, txt, eot - txt, se_max, rm, REG_NOTBOL ) );
     i = eot - txt;
-    if( !resize_buffer( txtbufp, txtbufszp, offset + i + 2 ) ) return -1;
-    if( isbinary() ) newline_to_nul( txt, i );
-    memcpy( *txtbufp + offset, txt, i );		/* tail copy */
+    if( !resize( txtbufp, txtbufszp, offset + i + 2 ) ) return -1;
+    copy_text( *txtbufp + offset, txt, i, nuls );	/* tail copy */
     memcpy( *txtbufp + offset + i, "\n", 2 );
     }
   return ( changed ? offset + i + 1 : 0 );
   }
 
 
+/* Produce new text with one or all matches replaced in a line.
+   Return size of the new line text, 0 if no change, -1 if error */
+static int line_replace( char ** txtbufp, int * const txtbufszp,
+                         const line_t * const lp, const int snum )
+  {
+  const regcache_t * const rp = regex_entry( subst_regexp );
+  const regex_t * const exp = text_regex( subst_regexp );
+  const char * errmsg = 0;
+  int size = -1;
+  bool raw = false;
+
+  disable_interrupts();
+  const char * const t = get_sbuf_text( lp );
+  if( t && prefilter_text( rp, t, lp->len ) == 0 ) size = 0;
+  else if( t && raw_matchable( t, lp->len ) )
+    { raw = true;
+      size = replace_text( txtbufp, txtbufszp, 0, t, lp->len, rp,
+                           exp, snum, false, resize_buffer, &errmsg ); }
+  enable_interrupts();
+  if( t && size < 0 && !raw )
+    {
+    char * const txt = get_sbuf_line( lp );
+    if( !txt ) return -1;
+    if( isbinary() ) nul_to_newline( txt, lp->len );
+    size = replace_text( txtbufp, txtbufszp, 0, txt, lp->len, rp,
+                         exp, snum, isbinary(), resize_buffer, &errmsg );
+    }
+  if( errmsg ) set_error_msg( errmsg );
+  return size;
+  }
+
+
+/* Replaced lines are committed in runs. The new texts of a run of
+   consecutive lines are collected, and then the run is replaced with one
+   delete_lines and one put_sbuf_lines, recorded by two undo atoms. */
+
+enum { pending_max = 1 << 20 };	/* max bytes of new text collected */
+static char * pbuf = 0;		/* new text of the pending run */
+static int pbufsz = 0;
+static int plen = 0;		/* bytes in pbuf */
+static int pfirst = 0;		/* address of first line of the run */
+static int pn = 0;		/* lines in the run */
+
+
+/* Replace the pending run with its new text. The addresses after the run
+   change, and so *addrp is updated. Return false if error. */
+static bool flush_replaced_lines( int * const addrp, const bool isglobal )
+  {
+  if( pn <= 0 ) return true;
+  const int first = pfirst, n = pn;
+  bool ok;
+
+  pn = 0;
+  disable_interrupts();
+  ok = delete_lines( first, first + n - 1, isglobal );
+  if( ok )
+    {
+    yank_last_deleted_line();	/* as if deleted one at a time */
+    set_current_addr( first - 1 );
+    ok = put_sbuf_lines( pbuf, plen );
+    if( current_addr() >= first &&	/* record even a partial insertion */
+        !push_undo_atom( UADD, first, current_addr() ) ) ok = false;
+    }
+  enable_interrupts();
+  plen = 0;
+  if( ok ) *addrp += current_addr() - first + 1 - n;
+  return ok;
+  }
+
+
+/* Add the line at *addrp, with the 'size' bytes of new text in txt, to
+   the pending run. Return false if error. */
+static bool queue_replaced_line( int * const addrp, const char * const txt,
+                                 const int size, const bool isglobal )
+  {
+  if( pn > 0 && pfirst + pn != *addrp &&
+      !flush_replaced_lines( addrp, isglobal ) ) return false;
+  if( !resize_buffer( &pbuf, &pbufsz, plen + size ) ) return false;
+  memcpy( pbuf + plen, txt, size ); plen += size;
+  if( pn++ == 0 ) pfirst = *addrp;
+  return ( plen < pending_max || flush_replaced_lines( addrp, isglobal ) );
+  }
+
+
+/* Parallel matching.
+   The lines of a long range are processed in batches. Each batch is split
+   in chunks, one for each worker thread. A worker has its own copy of the
+   regex ( regexec serializes the callers of a regex_t ) and its own
+   buffers, reads the text of the lines through the mapping of the scratch
+   file, and does not touch any other state of ed. When all the workers of
+   a batch have finished, the main thread applies their results in address
+   order. This requires a memory-mapped scratch file. */
+
+enum { chunk_min = 8192,	/* min lines per worker */
+       chunk_max = 65536 };	/* max lines per worker and batch */
+
+typedef struct
+  {
+  pthread_t thread;
+  const regcache_t * rp;	/* regex compiled in exp, or 0 */
+  regex_t exp;			/* copy of rp->exp or rp->bexp for this thread */
+  const line_t * lp;		/* first line of the chunk */
+  int n;			/* number of lines in the chunk */
+  int snum;			/* for 's', else -1 */
+  char * res;			/* for g/v, 1 for each matching line */
+  int * sizes;			/* for 's', size of each new text, or 0 */
+  char * out;			/* for 's', new texts of the lines */
+  int outsz;
+  char * buf;			/* translated copy of the current line */
+  int bufsz;
+  int done;			/* lines processed without error */
+  const char * errmsg;		/* error found in line 'done', or 0 */
+  }
+worker_t;
+
+static int match_threads = 0;		/* if 0, one per processor */
+
+
+/* set the max number of worker threads; 1 disables parallel matching */
+void set_match_threads( const int n ) { match_threads = n; }
+
+
+/* like resize_buffer, but thread-safe and silent */
+static bool grow_buffer( char ** const buf, int * const size,
+                         const unsigned min_size )
+  {
+  if( (unsigned)*size >= min_size ) return true;
+  if( min_size >= INT_MAX ) return false;
+  const int new_size = ( ( min_size < 512 ) ? 512 :
+    ( min_size > INT_MAX / 2 ) ? INT_MAX : ( min_size / 512 ) * 1024 );
+  void * const new_buf = realloc( *buf, new_size );
+  if( !new_buf ) return false;
+  *size = new_size;
+  *buf = (char *)new_buf;
+  return true;
+  }
+
+
+static void * run_worker( void * const arg )
+  {
+  worker_t * const wp = (worker_t *)arg;
+  const regcache_t * const rp = wp->rp;
+  const line_t * lp = wp->lp;
+  int fd, outlen = 0;
+  long off;
+
+  for( wp->done = 0; wp->done < wp->n; ++wp->done, lp = lp->q_forw )
+    {
+    const int len = lp->len;
+    const char * const s = get_sbuf_mapped( lp, &fd, &off );
+    int m = ( wp->snum < 0 ) ? match_raw_text( rp, &wp->exp, s, len ) :
+            prefilter_text( rp, s, len );
+    const char * t = s;			/* text to match */
+    if( m < 0 || ( wp->snum >= 0 && m > 0 && !raw_matchable( s, len ) ) )
+      {
+      if( !grow_buffer( &wp->buf, &wp->bufsz, len + 1 ) )
+        { wp->errmsg = mem_msg; break; }
+      memcpy( wp->buf, s, len ); wp->buf[len] = 0;
+      if( isbinary() ) nul_to_newline( wp->buf, len );
+      t = wp->buf;
+      }
+    if( wp->snum < 0 )
+      {
+      if( m < 0 ) m = !match_regex( rp, &wp->exp, t, len, 0, 0, 0 );
+      wp->res[wp->done] = m;
+      continue;
+      }
+    int end = 0;
+    if( m > 0 )
+      {
+      end = replace_text( &wp->out, &wp->outsz, outlen, t, len, rp, &wp->exp,
+                          wp->snum, t != s && isbinary(), grow_buffer,
+                          &wp->errmsg );
+      if( end < 0 ) { if( !wp->errmsg ) wp->errmsg = mem_msg; break; }
+      }
+    wp->sizes[wp->done] = end ? end - outlen : 0;
+    if( end ) outlen = end;
+    }
+  return 0;
+  }
+
+
+/* Return the number of worker threads to use for n lines, or 0 if the
+   lines must be processed serially. */
+static int workers_for( const int n )
+  {
+  static int ncpus = 0;
+  if( !ncpus ) { ncpus = sysconf( _SC_NPROCESSORS_ONLN ); if( ncpus < 1 ) ncpus = 1; }
+  int w = match_threads ? match_threads : min( ncpus, 16 );
+  w = min( w, n / chunk_min );
+  return ( w >= 2 && sbuf_mapped() ) ? w : 0;
+  }
+
+
+/* Prepare w workers for regex exp. Return false if error.
+   The workers are kept from one command to the next, so that nothing is
+   lost if an interrupt jumps out of a command. */
+static worker_t * prepare_workers( const int w, const regex_t * const exp,
+                                   const int snum )
+  {
+  static worker_t * wk = 0;
+  static int wk_n = 0;			/* workers allocated */
+  const regcache_t * const rp = regex_entry( exp );
+  const bool bytes = ( text_regex( exp ) != exp );
+
+  if( w > wk_n )
+    {
+    worker_t * const p = (worker_t *) realloc( wk, w * sizeof (worker_t) );
+    if( !p ) { set_error_msg( mem_msg ); return 0; }
+    memset( p + wk_n, 0, ( w - wk_n ) * sizeof (worker_t) );
+    wk = p; wk_n = w;
+    }
+  for( int i = 0; i < w; ++i )
+    {
+    worker_t * const wp = &wk[i];
+    if( wp->rp ) { regfree( &wp->exp ); wp->rp = 0; }
+    if( !wp->res ) wp->res = (char *) malloc( chunk_max );
+    if( !wp->sizes ) wp->sizes = (int *) malloc( chunk_max * sizeof (int) );
+    if( !wp->res || !wp->sizes )
+      { set_error_msg( mem_msg ); return 0; }
+    if( compile_in( &wp->exp, rp->pat, rp->cflags, bytes ) != 0 )
+      { set_error_msg( mem_msg ); return 0; }
+    wp->rp = rp; wp->snum = snum;
+    }
+  return wk;
+  }
+
+
+/* Run the workers on the batch of lines starting at addr. Return the
+   number of lines of the batch. Signals are blocked in the workers, so
+   that they are always handled by the main thread. */
+static int run_batch( worker_t * const wk, const int w, const int addr,
+                      const int n )
+  {
+  const int bn = min( n, w * chunk_max );
+  const int per = ( bn + w - 1 ) / w;
+  sigset_t all, old;
+  int i;
+
+  disable_interrupts();
+  for( i = 0; i < w; ++i )
+    {
+    wk[i].n = max( 0, min( per, bn - i * per ) );
+    wk[i].lp = wk[i].n ? search_line_node( addr + i * per ) : 0;
+    wk[i].errmsg = 0;
+    }
+  sigfillset( &all );
+  pthread_sigmask( SIG_SETMASK, &all, &old );
+  for( i = 1; i < w; ++i )
+    if( pthread_create( &wk[i].thread, 0, run_worker, &wk[i] ) != 0 )
+      wk[i].thread = pthread_self();	/* run it below */
+  pthread_sigmask( SIG_SETMASK, &old, 0 );
+  run_worker( &wk[0] );
+  for( i = 1; i < w; ++i )
+    {
+    if( pthread_equal( wk[i].thread, pthread_self() ) ) run_worker( &wk[i] );
+    else pthread_join( wk[i].thread, 0 );
+    }
+  rx_mt_lines += bn;
+  enable_interrupts();
+  return bn;
+  }
+
+
+/* add lines matching a regex to the global-active list, in parallel */
+static bool build_active_list_mt( const regex_t * const exp, int addr,
+                                  const int second_addr, const bool match,
+                                  const int w )
+  {
+  worker_t * const wk = prepare_workers( w, exp, -1 );
+
+  if( !wk ) return false;
+  bool ok = true;
+  while( ok && addr <= second_addr )
+    {
+    const int bn = run_batch( wk, w, addr, second_addr - addr + 1 );
+    line_t * lp = search_line_node( addr );
+    for( int i = 0; ok && i < w; ++i )
+      for( int j = 0; j < wk[i].n; ++j, lp = lp->q_forw )
+        {
+        if( j >= wk[i].done ) { set_error_msg( wk[i].errmsg ); ok = false; break; }
+        if( match == wk[i].res[j] && !set_active_node( lp ) )
+          { ok = false; break; }
+        }
+    addr += bn;
+    }
+  return ok;
+  }
+
+
+/* substitute in a range of lines, in parallel */
+static bool search_and_replace_mt( int addr, const int second_addr,
+                                   const int snum, const bool isglobal,
+                                   bool * const match_foundp, const int w,
+                                   int * const error_addrp )
+  {
+  worker_t * const wk = prepare_workers( w, subst_regexp, snum );
+
+  if( !wk ) return false;
+  bool ok = true;
+  int n = second_addr - addr + 1;	/* lines left */
+  while( ok && n > 0 )
+    {
+    const int bn = run_batch( wk, w, addr, n );
+    for( int i = 0; ok && i < w; ++i )
+      {
+      const char * txt = wk[i].out;
+      for( int j = 0; j < wk[i].n; ++j, ++addr )
+        {
+        if( j >= wk[i].done ) { set_error_msg( wk[i].errmsg ); ok = false; break; }
+        const int size = wk[i].sizes[j];
+        if( !size )
+          { if( !flush_replaced_lines( &addr, isglobal ) ) ok = false; }
+        else if( queue_replaced_line( &addr, txt, size, isglobal ) )
+          { txt += size; *match_foundp = true; }
+        else ok = false;
+        if( !ok ) break;
+        }
+      }
+    n -= bn;
+    }
+  if( !flush_replaced_lines( &addr, isglobal ) ) ok = false;
+  if( !ok && error_addrp ) *error_addrp = addr;
+  return ok;
+  }
+
+
+/* add lines matching a regular expression to the global-active list */
+bool build_active_list( const char ** const ibufpp, const int first_addr,
+                        const int second_addr, const bool match )
+  {
+  int addr;
+
+  const regex_t * const exp = get_compiled_regex( ibufpp );
+  if( !exp ) return false;
+  clear_active_list();
+  const int w = workers_for( second_addr - first_addr + 1 );
+  if( w ) return build_active_list_mt( exp, first_addr, second_addr, match, w );
+  line_t * lp = search_line_node( first_addr );
+  for( addr = first_addr; addr <= second_addr; ++addr, lp = lp->q_forw )
+    {
+    const int m = line_matches( exp, lp );
+    if( m < 0 ) return false;
+    if( match == ( m > 0 ) && !set_active_node( lp ) ) return false;
+    }
+  return true;
+  }
+
+
 /* for each line in a range, change text matching a regular expression
-   according to a substitution template (replacement); return false if error */
+   according to a substitution template (replacement); return false if error,
+   and if error_addrp is not null, store in it the address of the line
+   being replaced when the error occurred */
 bool search_and_replace( const int first_addr, const int second_addr,
-                         const int snum, const bool isglobal )
+                         const int snum, const bool isglobal,
+                         int * const error_addrp )
   {
   static char * txtbuf = 0;		/* new text of line buffer */
   static int txtbufsz = 0;		/* new text of line buffer size */
   int addr = first_addr;
   int lc;
   bool match_found = false;
+  const int w = workers_for( second_addr - first_addr + 1 );
 
-  for( lc = 0; lc <= second_addr - first_addr; ++lc, ++addr )
+  pn = plen = 0;			/* drop a run left by an interrupt */
+  if( w )
+    {
+    if( !search_and_replace_mt( first_addr, second_addr, snum, isglobal,
+                                &match_found, w, error_addrp ) ) return false;
+    }
+  else
     {
-    const line_t * const lp = search_line_node( addr );
-    const int size = line_replace( &txtbuf, &txtbufsz, lp, snum );
-    if( size < 0 ) return false;
-    if( size )
+    for( lc = 0; lc <= second_addr - first_addr; ++lc, ++addr )
       {
-      const char * txt = txtbuf;
-      const char * const eot = txtbuf + size;
-      undo_t * up = 0;
-      disable_interrupts();
-      if( !delete_lines( addr, addr, isglobal ) )
-        { enable_interrupts(); return false; }
-      set_current_addr( addr - 1 );
-      do {
-        txt = put_sbuf_line( txt, eot - txt );
-        if( !txt ) { enable_interrupts(); return false; }
-        if( up ) up->tail = search_line_node( current_addr() );
-        else
-          {
-          up = push_undo_atom( UADD, current_addr(), current_addr() );
-          if( !up ) { enable_interrupts(); return false; }
-          }
-        }
-      while( txt != eot );
-      enable_interrupts();
-      addr = current_addr();
-      match_found = true;
+      const line_t * const lp = search_line_node( addr );
+      const int size = line_replace( &txtbuf, &txtbufsz, lp, snum );
+      if( size < 0 ) flush_replaced_lines( &addr, isglobal );
+      else if( size ? queue_replaced_line( &addr, txtbuf, size, isglobal ) :
+                      flush_replaced_lines( &addr, isglobal ) )
+        { if( size ) match_found = true; continue; }
+      if( error_addrp ) *error_addrp = addr;
+      return false;
       }
+    if( !flush_replaced_lines( &addr, isglobal ) ) return false;
     }
   if( !match_found && !isglobal )
     { set_error_msg( no_match ); return false; }
   return true;
   }
+
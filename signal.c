@@ -25,6 +25,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <termios.h>
+#include <time.h>
 #include <unistd.h>
 #include <sys/ioctl.h>
 
@@ -37,6 +38,8 @@ static int window_lines_ = 22;		/* scroll lines set by sigwinch_handler */
 static int window_columns_ = 72;
 static bool sighup_pending = false;
 static bool sigint_pending = false;
+static bool sigio_pending = false;
+static int child_pid = 0;		/* if > 0, its group gets SIGINT */
 
 
 static void sighup_handler( int signum )
@@ -44,6 +47,8 @@ static void sighup_handler( int signum )
   if( signum ) {}			/* keep compiler happy */
   if( mutex ) { sighup_pending = true; return; }
   sighup_pending = false;
+  if( journal_base_intact() && flush_journal() )
+    exit( 0 );				/* the journal has all the changes */
   const char hb[] = "ed.hup";
   if( last_addr() <= 0 || !modified() ||
       write_file( hb, "w", 1, last_addr() ) >= 0 ) exit( 0 );
@@ -64,7 +69,10 @@ static void sighup_handler( int signum )
 
 static void sigint_handler( int signum )
   {
-  if( mutex ) sigint_pending = true;
+  if( child_pid > 0 )			/* ed is interrupted when it ends */
+    { if( !sigint_pending ) kill( -child_pid, SIGINT );
+      sigint_pending = true; }
+  else if( mutex ) sigint_pending = true;
   else
     {
     sigset_t set;
@@ -77,6 +85,19 @@ static void sigint_handler( int signum )
   }
 
 
+/* a lease on a mapped input file is being broken; copy it before
+   the other process can modify it */
+static void sigio_handler( int signum )
+  {
+  if( signum ) {}			/* keep compiler happy */
+  if( mutex ) { sigio_pending = true; return; }
+  sigio_pending = false;
+  const int saved_errno = errno;
+  copy_sources( 0 );
+  errno = saved_errno;
+  }
+
+
 static void sigwinch_handler( int signum )
   {
 #ifdef TIOCGWINSZ
@@ -113,6 +134,7 @@ void enable_interrupts( void )
   if( --mutex <= 0 )
     {
     mutex = 0;
+    if( sigio_pending ) sigio_handler( SIGIO );
     if( sighup_pending ) sighup_handler( SIGHUP );
     if( sigint_pending ) sigint_handler( SIGINT );
     }
@@ -122,6 +144,19 @@ void enable_interrupts( void )
 void disable_interrupts( void ) { ++mutex; }
 
 
+/* Send SIGINT to the process group led by 'pid' while ed waits for it,
+   leaving it pending for ed until called with pid 0. */
+void forward_interrupts( const int pid ) { child_pid = pid; }
+
+
+/* to be called before taking a lease on a file */
+void catch_sigio( void )
+  {
+  static bool done = false;
+  if( !done ) { set_signal( SIGIO, sigio_handler ); done = true; }
+  }
+
+
 void set_signals( void )
   {
 #ifdef SIGWINCH
@@ -139,6 +174,15 @@ int window_columns( void ) { return window_columns_; }
 int window_lines( void ) { return window_lines_; }
 
 
+/* return the time of a monotonic clock, in nanoseconds */
+long long monotonic_ns( void )
+  {
+  struct timespec ts;
+  clock_gettime( CLOCK_MONOTONIC, &ts );
+  return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+  }
+
+
 /* assure at least a minimum size for buffer 'buf' */
 bool resize_buffer( char ** const buf, int * const size, const unsigned min_size )
   {
@@ -0,0 +1,11 @@
+me appears insurmountable in the way to the perfectibility OF society.
+All other arguments are OF slight and subordinate consideration in
+comparison OF this. I see no way by which man can escape from the weight
+OF this law which pervades all animated nature. No fancied equality, no
+agrarian regulations in their utmost extent, could remove the pressure
+OF it even for a single century. And it appears, therefore, to be
+decisive against the possible existence OF a society, all the members of
+which should live in ease, happiness, and comparative leisure; and feel
+no anxiety about providing the means OF subsistence for themselves and
+their families.
+appended line
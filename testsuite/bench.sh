@@ -0,0 +1,103 @@
+#! /bin/sh
+# benchmark script for GNU ed - The GNU line editor
+# Copyright (C) 2006-2022 Antonio Diaz Diaz.
+#
+# This script is free software; you have unlimited permission
+# to copy, distribute, and modify it.
+#
+# Run scripted workloads on a large generated file, and print one JSON
+# object per workload on standard output. BENCH_LINES sets the number of
+# lines of the file (default 1000000). BENCH_ONLY, if set, is a list of
+# the names of the workloads to run.
+
+LC_ALL=C
+export LC_ALL
+objdir=`pwd`
+testdir=`cd "$1" ; pwd`
+ED="${objdir}"/ed
+RUN="${objdir}"/benchrun
+lines=${BENCH_LINES:-1000000}
+half=`expr ${lines} / 2`
+framework_failure() { echo "failure in benchmark framework" 1>&2 ; exit 1 ; }
+
+if [ ! -f "${ED}" ] || [ ! -x "${ED}" ] ; then
+	echo "${ED}: cannot execute" 1>&2
+	exit 1
+fi
+if [ ! -x "${RUN}" ] ; then
+	echo "${RUN}: cannot execute" 1>&2
+	exit 1
+fi
+
+if [ -d bench ] ; then rm -rf bench ; fi
+mkdir bench
+cd bench || framework_failure
+
+# Deterministic input: numbered lines with some varying words.
+awk -v n=${lines} 'BEGIN {
+	split( "alpha beta gamma delta epsilon zeta eta theta", w, " " )
+	for( i = 1; i <= n; ++i )
+		printf "%d the quick %s fox %d jumps over the lazy %s dog\n",
+		       i, w[i % 8 + 1], i * 7 % 1000, w[i % 5 + 1] }' > in.txt ||
+	framework_failure
+
+# 10000 random addresses, from a Park-Miller generator (exact in awk).
+awk -v n=${lines} 'BEGIN {
+	x = 1
+	for( i = 0; i < 10000; ++i )
+		{ x = ( x * 16807 ) % 2147483647; printf "%dp\n", x % n + 1 }
+	print "q" }' > jumps.ed || framework_failure
+
+# 5000 marks set at random addresses, each used as a range anchor.
+awk -v n=${lines} 'BEGIN {
+	x = 1
+	for( i = 0; i < 5000; ++i )
+		{ x = ( x * 16807 ) % 2147483647 ; c = sprintf( "%c", 97 + i % 26 )
+		  printf "%dk%s\n%c%s,%c%s+2s/$/./\n", x % ( n - 2 ) + 1, c,
+		         39, c, 39, c }
+	print "Q" }' > marks.ed || framework_failure
+
+fail=0
+echo "{\"benchmark\":\"ed\",\"lines\":${lines},\"bytes\":`wc -c < in.txt`}"
+
+# bench name options script
+bench() {
+	name=$1 ; opts=$2
+	if [ -n "${BENCH_ONLY}" ] ; then
+		case " ${BENCH_ONLY} " in *" ${name} "*) ;; *) return ;; esac
+	fi
+	case "$3" in
+		*.ed) cp "$3" cmd.ed ;;
+		*) printf "$3" > cmd.ed ;;
+	esac
+	set -- `"${RUN}" cmd.ed "${ED}" -s ${opts} in.txt`
+	[ $# = 7 ] || framework_failure
+	echo "{\"name\":\"${name}\",\"options\":\"${opts}\",\"wall_s\":$1,\"user_s\":$2,\"sys_s\":$3,\"max_rss_kb\":$4,\"bytes_per_line\":`expr $4 \* 1024 / ${lines}`,\"read_calls\":$5,\"write_calls\":$6,\"status\":$7}"
+	if [ $7 != 0 ] ; then
+		echo "*** workload ${name} exited with status $7 ***" 1>&2
+		fail=1
+	fi
+	rm -f cmd.ed out.txt
+}
+
+bench read      ""              'q\n'
+bench read_map  --map-input     'q\n'
+bench read_lazy --lazy-index    '1,100p\nq\n'
+bench write     ""              'w out.txt\nq\n'
+bench write_map --map-input     'w out.txt\nq\n'
+bench r_append  ""              '$r in.txt\nQ\n'
+bench g_delete  ""              'g/[05] jumps/d\nQ\n'
+bench v_delete  ""              'v/alpha/d\nQ\n'
+bench s_global  ""              ',s/o/0/g\nQ\n'
+bench g_subst   ""              'g/fox/s//FOX/\nQ\n'
+bench t_range   ""              "1,${half}t\$\nQ\n"
+bench m_range   ""              "1,${half}m\$\nQ\n"
+bench u_subst   ""              ',s/the/THE/\nu\nu\nQ\n'
+bench u_delete  ""              '2,$d\nu\nQ\n'
+bench j_all     ""              '1,$j\nQ\n'
+bench filter    ""              ',|cat\nQ\n'
+bench jumps     ""              jumps.ed
+bench marks     ""              marks.ed
+
+cd "${objdir}" && rm -rf bench
+exit ${fail}
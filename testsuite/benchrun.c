@@ -0,0 +1,87 @@
+/* benchrun - run a command and report the resources it used. */
+/* Copyright (C) 2006-2022 Antonio Diaz Diaz.
+
+   This program is free software; you have unlimited permission
+   to copy, distribute, and modify it.
+*/
+/*
+   Usage: benchrun input_file command [arguments]
+
+   Run command with its standard input read from input_file and its
+   standard output discarded, and print on standard output:
+     wall_time user_time system_time max_rss_KiB read_calls write_calls status
+   Times are in seconds. The counts of read and write system calls are
+   taken from /proc/<pid>/io, or are -1 if it is not available.
+*/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+
+static double seconds( const struct timeval * const tv )
+  { return tv->tv_sec + tv->tv_usec / 1e6; }
+
+
+/* read the syscr and syscw fields of the io file of process 'pid' */
+static void read_io_counts( const pid_t pid, long * const syscr,
+                            long * const syscw )
+  {
+  char buf[64];
+  snprintf( buf, sizeof buf, "/proc/%ld/io", (long)pid );
+  FILE * const f = fopen( buf, "r" );
+  if( !f ) return;
+  char line[256];
+  while( fgets( line, sizeof line, f ) )
+    {
+    if( strncmp( line, "syscr: ", 7 ) == 0 ) *syscr = strtol( line + 7, 0, 10 );
+    else if( strncmp( line, "syscw: ", 7 ) == 0 ) *syscw = strtol( line + 7, 0, 10 );
+    }
+  fclose( f );
+  }
+
+
+int main( const int argc, char * const argv[] )
+  {
+  struct timespec t0, t1;
+  struct rusage ru;
+  siginfo_t si;
+  long syscr = -1, syscw = -1;
+  int status;
+
+  if( argc < 3 )
+    { fputs( "Usage: benchrun input_file command [arguments]\n", stderr );
+      return 1; }
+  clock_gettime( CLOCK_MONOTONIC, &t0 );
+  const pid_t pid = fork();
+  if( pid < 0 ) { perror( "benchrun: fork" ); return 1; }
+  if( pid == 0 )
+    {
+    const int in = open( argv[1], O_RDONLY );
+    const int out = open( "/dev/null", O_WRONLY );
+    if( in < 0 || out < 0 || dup2( in, 0 ) < 0 || dup2( out, 1 ) < 0 )
+      { perror( "benchrun" ); _exit( 127 ); }
+    close( in ); close( out );
+    execv( argv[2], argv + 2 );
+    perror( argv[2] ); _exit( 127 );
+    }
+  /* wait for the exit, leaving the child waitable to read its counts */
+  while( waitid( P_PID, pid, &si, WEXITED | WNOWAIT ) != 0 )
+    if( errno != EINTR ) { perror( "benchrun: waitid" ); return 1; }
+  clock_gettime( CLOCK_MONOTONIC, &t1 );
+  read_io_counts( pid, &syscr, &syscw );
+  if( wait4( pid, &status, 0, &ru ) != pid )
+    { perror( "benchrun: wait4" ); return 1; }
+  printf( "%.3f %.3f %.3f %ld %ld %ld %d\n",
+          ( t1.tv_sec - t0.tv_sec ) + ( t1.tv_nsec - t0.tv_nsec ) / 1e9,
+          seconds( &ru.ru_utime ), seconds( &ru.ru_stime ), ru.ru_maxrss,
+          syscr, syscw,
+          WIFEXITED( status ) ? WEXITSTATUS( status ) : 128 + WTERMSIG( status ) );
+  return 0;
+  }
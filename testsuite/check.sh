@@ -71,9 +71,34 @@ done
 # Run the .ed scripts and compare their output against the .r files,
 # which contain the correct output.
 # The .ed scripts should exit with zero status.
-for i in "${testdir}"/*.ed ; do
-	base=`echo "$i" | sed 's,^.*/,,;s,\.ed$,,'`	# remove dir and ext
-	if "${ED}" -s test.txt < "$i" > /dev/null 2> out.log ; then
+# Run them again with each alternative buffer backend.
+for opts in "" --stdio-scratch --map-input --lazy-index --safe-save \
+	--regex-cache=3 --stats=histogram --tail-reload \
+	"--map-input --incremental-write" ; do
+	for i in "${testdir}"/*.ed ; do
+		base=`echo "$i" | sed 's,^.*/,,;s,\.ed$,,'`	# remove dir and ext
+		if "${ED}" -s ${opts} test.txt < "$i" > /dev/null 2> out.log ; then
+			if cmp -s out.o "${testdir}"/${base}.r ; then
+				true
+			else
+				mv -f out.o ${base}.o
+				echo "*** Output ${base}.o of script $i ${opts} is incorrect ***"
+				fail=127
+			fi
+		else
+			mv -f out.log ${base}.log
+			echo "*** The script $i ${opts} exited abnormally ***"
+			fail=127
+		fi
+		rm -f out.o out.log
+	done
+done
+
+# Run the .mu scripts with multi-level undo, and compare their output
+# against the .r files.
+for i in "${testdir}"/*.mu ; do
+	base=`echo "$i" | sed 's,^.*/,,;s,\.mu$,,'`	# remove dir and ext
+	if "${ED}" -s --undo-levels=10 test.txt < "$i" > /dev/null 2> out.log ; then
 		if cmp -s out.o "${testdir}"/${base}.r ; then
 			true
 		else
@@ -89,6 +114,110 @@ for i in "${testdir}"/*.ed ; do
 	rm -f out.o out.log
 done
 
+# Run the .cr scripts with a journal; they kill ed at the end. Recover
+# the buffer from the journal and compare it against the .r files.
+for i in "${testdir}"/*.cr ; do
+	base=`echo "$i" | sed 's,^.*/,,;s,\.cr$,,'`	# remove dir and ext
+	"${ED}" -s --journal=out.j test.txt < "$i" > /dev/null 2>&1
+	if echo "w out.o" | "${ED}" -s --recover=out.j > /dev/null 2> out.log ; then
+		if cmp -s out.o "${testdir}"/${base}.r ; then
+			true
+		else
+			mv -f out.o ${base}.o
+			echo "*** Output ${base}.o of recovered script $i is incorrect ***"
+			fail=127
+		fi
+	else
+		mv -f out.log ${base}.log
+		echo "*** The recovery of script $i failed ***"
+		fail=127
+	fi
+	rm -f out.o out.log out.j out.j1 out.j2
+done
+
+# Run the .bt scripts in batch mode on copies of test.txt, given as
+# arguments or read from stdin; they write each copy back. Compare the
+# copies against the .r files.
+for i in "${testdir}"/*.bt ; do
+	base=`echo "$i" | sed 's,^.*/,,;s,\.bt$,,'`	# remove dir and ext
+	cp test.txt out1.b && cp test.txt out2.b && cp test.txt out3.b ||
+		framework_failure
+	if "${ED}" -s --batch="$i" --jobs=2 out1.b out2.b > /dev/null 2> out.log &&
+	   printf 'out3.b\0' | "${ED}" -s --batch="$i" > /dev/null 2>> out.log ; then
+		for j in out1.b out2.b out3.b ; do
+			if cmp -s $j "${testdir}"/${base}.r ; then
+				true
+			else
+				mv -f $j ${base}.$j
+				echo "*** Output ${base}.$j of batch script $i is incorrect ***"
+				fail=127
+			fi
+		done
+	else
+		mv -f out.log ${base}.log
+		echo "*** The batch script $i exited abnormally ***"
+		fail=127
+	fi
+	rm -f out1.b out2.b out3.b out.log
+done
+
+# Run the .mt scripts serially and with two worker threads; they make
+# enough lines for parallel matching. Compare the outputs, and check that
+# the worker threads matched lines.
+for i in "${testdir}"/*.mt ; do
+	base=`echo "$i" | sed 's,^.*/,,;s,\.mt$,,'`	# remove dir and ext
+	if "${ED}" -s --threads=1 test.txt < "$i" > /dev/null 2> out.log &&
+		mv -f out.o out1.t &&
+		"${ED}" -s --threads=2 --stats test.txt < "$i" > /dev/null 2> out.log ; then
+		if cmp -s out.o out1.t &&
+			grep -q '^regex: [1-9][0-9]* lines matched in worker threads' out.log ; then
+			true
+		else
+			mv -f out.o ${base}.o
+			echo "*** Output ${base}.o of script $i --threads=2 is incorrect ***"
+			fail=127
+		fi
+	else
+		mv -f out.log ${base}.log
+		echo "*** The script $i exited abnormally ***"
+		fail=127
+	fi
+	rm -f out.o out1.t out.log
+done
+
+# Run the .u8 scripts in a UTF-8 locale, if there is one, with each regex
+# matcher that gives the same result as the locale, and compare their
+# output against the .r files.
+u8=
+for loc in C.UTF-8 C.utf8 en_US.UTF-8 ; do
+	if [ "`LC_ALL=${loc} locale charmap 2> /dev/null`" = UTF-8 ] ; then
+		u8=${loc} ; break
+	fi
+done
+if [ -n "${u8}" ] ; then
+	for opts in --regex-matcher=locale --regex-matcher=auto \
+		"--regex-matcher=auto --lazy-index" \
+		"--regex-matcher=auto --map-input --threads=2" ; do
+		for i in "${testdir}"/*.u8 ; do
+			base=`echo "$i" | sed 's,^.*/,,;s,\.u8$,,'`	# remove dir and ext
+			if LC_ALL=${u8} "${ED}" -s ${opts} test.txt < "$i" > /dev/null 2> out.log ; then
+				if cmp -s out.o "${testdir}"/${base}.r ; then
+					true
+				else
+					mv -f out.o ${base}.o
+					echo "*** Output ${base}.o of script $i ${opts} is incorrect ***"
+					fail=127
+				fi
+			else
+				mv -f out.log ${base}.log
+				echo "*** The script $i ${opts} exited abnormally ***"
+				fail=127
+			fi
+			rm -f out.o out.log
+		done
+	done
+fi
+
 rm -f test.txt test.bin zero
 
 if [ ${fail} = 0 ] ; then
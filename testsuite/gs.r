@@ -0,0 +1,26 @@
+.thEfamili irEs.!
+Tnatural his
+inEof quality thE two powers of population and of
+in production
+thE Earth, and that great law of our naturE which must
+k constantlyEEp
+thEir Effects Equal, form thE grEat difficulty that to
+mEapp Ears
+insurmountablEin  thE way to the pErfEctibility of sociEty.
+Aoth llEr
+argumEar ntsE of slight and subordinate considEration in
+of comparison
+this. I sEE no way by which man can escapE from thE wEight
+this of
+law which pervades all animated nature. No fancied equality, no
+r agrarianEgulations
+th inEir utmost Extent, could rEmovE thE prEssurE
+it of
+EvEfor n a single cEntury. And it appEars, thErEforE, to bE
+dEcisivEagainst 
+thEpossibl E existEncE of a sociEty, all thE mEmbErs of
+should which
+in live ease, happiness, and comparative leisure; and feel
+anxi noEty
+providing about thE mEans of subsistencE for thEmsElvEs and
+.thEfamili irEs.!
@@ -0,0 +1,15 @@
+hTis natural inequality of thEwo powers of population and of
+p[roduction ]in the earth, and that grE law of our nature which must
+c[onstantly ]keep their effEs equal, form the great difficulty that to
+em appears insurmountable in the way to the perfEibility of society.
+lAl other argumEs are of slight and subordinate consideration in
+ocmparison of this. I see no way by which man can escape from the weight
+fo this law which pervades all animated nature. No fancied equality, no
+gararian regulations in their utmost Eent, could remove the pressure
+fo it even for a single cEury. And it appears, therefore, to be
+edcisive against the possible existence of a society, all the members of
+hwich should live in ease, happiness, and comparative leisure; and feel
+on anxiety about providing the means of subsistence for themselves and
+hteir families.
+<naïv>e caF Uer
+Jd_vu
@@ -0,0 +1,13 @@
+This natural inequality of THE two powErs of population and of.
+production in THE earth, and that grEat law of our nature which must.
+constantly keep THEir effects EQUAL, form THE great difficulty that to
+me appEars insurmountable in THE way to THE perfectibility of society..
+All oTHEr arguments arE of slight and subordinate consideration in.
+comparison of this. I seE no way by which man can escape from THE weight.
+of this law which pervadEs all animated nature. No fancied equality, no.
+agrarian regulations in THEir utmost Extent, could remove THE pressure.
+OF it evEn for a single century. And it appears, THErefore, to be.
+decisivE against THE possible existence of a society, all THE members of.
+which should live in Ease, happiness, and comparative leisure; and feel.
+no anxiety about providing THE mEans of subsistence for THEmselves and.
+>THEir families..
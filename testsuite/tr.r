@@ -0,0 +1,12 @@
+their families.
+one
+two
+their families.
+one
+two
+three
+new
+file
+new
+file
+added
@@ -0,0 +1,6 @@
+constantly keep their effects equal, form the great difficulty that to
+Xe appears insurmountable in the way to the perfectibility of society.
+me appears insurmountable in the way to the perfectibility of society.
+of it even for a single century. And it appears, therefore, to be
+decisive against the possible existence of a society, all the members of
+their families.